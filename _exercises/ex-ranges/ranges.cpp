@@ -8,6 +8,10 @@
 #include <source_location>
 #include <ranges>
 #include <helpers.hpp>
+#include <tokenizer.hpp>
+#include <mapped_lines.hpp>
+#include <filesystem>
+#include <fstream>
 
 template <typename T1, typename T2>
 std::ostream& operator<<(std::ostream& out, const std::pair<T1, T2>& p)
@@ -24,10 +28,10 @@ std::pair<std::string_view, std::string_view> split(std::string_view line, std::
 {
     std::pair<std::string_view, std::string_view> result;
 
-    if (std::string::size_type pos = line.find(separator.data()); pos != std::string::npos)
+    if (std::string::size_type pos = helpers::find_separator(line, separator); pos != std::string::npos)
     {
         result.first = std::string_view{line.begin(), line.begin() + pos};
-        result.second = std::string_view{line.begin() + pos + 1, line.end()};
+        result.second = std::string_view{line.begin() + pos + separator.size(), line.end()};
     }
 
     return result;
@@ -48,6 +52,13 @@ TEST_CASE("split")
     CHECK(split(s4) == std::pair{""sv, "434"sv});
 }
 
+// the record-parsing pipeline - works on any range of lines (in memory or helpers::mapped_lines)
+// blank lines are "\n" in memory and empty string_views in mapped files
+const auto records = std::views::drop_while( []( std::string_view str ) { return str.starts_with( '#' ); } )
+    | std::views::filter( []( std::string_view str ) { return !str.empty() && str != "\n"; } )
+    | std::views::transform( []( std::string_view str ) { return split( str ); })
+    | std::views::elements<1>;
+
 TEST_CASE("Exercise - ranges")
 {
     const std::vector<std::string_view> lines = { 
@@ -71,16 +82,30 @@ TEST_CASE("Exercise - ranges")
     //                     | std::ranges::views::transform([](std::string_view line){ return split(line).second; });
 
 
-    auto result = lines 
-        | std::views::drop_while( []( std::string_view str ) { return str.starts_with( '#' ); } )
-        | std::views::filter( []( std::string_view str ) { return str != "\n"; } )
-        | std::views::transform( []( std::string_view str ) { return split( str ); })
-        | std::views::elements<1>;
-    
+    auto result = lines | records;
 
     helpers::print(result, "result");
 
     auto expected_result = {"one"s, "two"s, "three"s, "four"s, "five"s, "six"s};
 
     CHECK(std::ranges::equal(result, expected_result));    
-}
\ No newline at end of file
+}
+
+TEST_CASE("Exercise - ranges - memory-mapped file")
+{
+    const auto path = std::filesystem::temp_directory_path() / "ex-ranges-records.txt";
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "# Comment 1\n# Comment 2\n1/one\n2/two\n\n3/three\r\n\n\n4/four\n";
+    }
+
+    {
+        auto result = helpers::mapped_lines(path) | records; // string_views into the mapping - no allocation per line
+
+        auto expected_result = {"one"s, "two"s, "three"s, "four"s};
+
+        CHECK(std::ranges::equal(result, expected_result));
+    }
+
+    std::filesystem::remove(path);
+}
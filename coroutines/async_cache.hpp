@@ -0,0 +1,126 @@
+#ifndef ASYNC_CACHE_HPP
+#define ASYNC_CACHE_HPP
+
+#include "shared_task.hpp"
+#include "task.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+struct AsyncCacheStats
+{
+    std::size_t hits = 0; // served by a cached or in-flight load
+    std::size_t misses = 0; // started a new load
+    std::size_t evictions = 0;
+};
+
+// Keyed cache of asynchronously loaded values: co_await cache.get(key)
+//  - concurrent requests for the same key share one in-flight load (SharedTask) - the loader runs once per key
+//  - an entry expires ttl after its load was started; expired entries are evicted in FIFO order by get(),
+//    so the size of the cache is bounded by the number of keys requested within ttl
+//  - loads still in flight are never evicted (they would be started again by the next request)
+//  - a failed load is not cached - the awaiters get the exception, the next get() starts a new load
+//  - thread-safe; the cache must outlive the loads it has started
+template <typename TKey, typename TValue, typename TClock = std::chrono::steady_clock>
+class AsyncCache
+{
+public:
+    using Loader = std::function<Task<TValue>(const TKey&)>;
+    using Duration = typename TClock::duration;
+
+    AsyncCache(Loader loader, Duration ttl)
+        : loader_{std::move(loader)}
+        , ttl_{ttl}
+    { }
+
+    AsyncCache(const AsyncCache&) = delete;
+    AsyncCache& operator=(const AsyncCache&) = delete;
+
+    [[nodiscard]] SharedTask<TValue> get(const TKey& key)
+    {
+        const auto now = TClock::now();
+
+        std::lock_guard lk{mtx_};
+        evict_expired(now);
+
+        if (auto it = entries_.find(key); it != entries_.end() && !it->second.value.has_failed())
+        {
+            ++stats_.hits;
+            return it->second.value;
+        }
+
+        ++stats_.misses;
+        Entry& entry = entries_.insert_or_assign(key, Entry{load(loader_, key), now + ttl_}).first->second;
+        expiries_.push_back({key, entry.expires_at});
+        return entry.value;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard lk{mtx_};
+        return entries_.size();
+    }
+
+    AsyncCacheStats stats() const
+    {
+        std::lock_guard lk{mtx_};
+        return stats_;
+    }
+
+private:
+    using TimePoint = typename TClock::time_point;
+
+    struct Entry
+    {
+        SharedTask<TValue> value;
+        TimePoint expires_at;
+    };
+
+    struct Expiry
+    {
+        TKey key;
+        TimePoint expires_at;
+    };
+
+    Loader loader_;
+    Duration ttl_;
+    mutable std::mutex mtx_;
+    std::unordered_map<TKey, Entry> entries_;
+    std::deque<Expiry> expiries_; // ordered by expires_at - one record per started load
+    AsyncCacheStats stats_;
+
+    static SharedTask<TValue> load(const Loader& loader, TKey key)
+    {
+        co_return co_await loader(key);
+    }
+
+    void evict_expired(TimePoint now)
+    {
+        while (!expiries_.empty() && expiries_.front().expires_at <= now)
+        {
+            Expiry expiry = std::move(expiries_.front());
+            expiries_.pop_front();
+
+            auto it = entries_.find(expiry.key);
+            if (it == entries_.end() || it->second.expires_at != expiry.expires_at)
+                continue; // the entry has been reloaded since - its own record is further in the queue
+
+            if (!it->second.value.is_ready())
+            {
+                it->second.expires_at = now + ttl_; // in flight - checked again one ttl later
+                expiries_.push_back({std::move(expiry.key), it->second.expires_at});
+                continue;
+            }
+
+            entries_.erase(it);
+            ++stats_.evictions;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,166 @@
+#include "async_generator.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct FlowCounters
+    {
+        int produced = 0;
+        int consumed = 0;
+        int max_in_flight = 0;
+        bool producer_destroyed = false;
+    };
+
+    struct DestructionFlag
+    {
+        bool& flag;
+
+        ~DestructionFlag()
+        {
+            flag = true;
+        }
+    };
+
+    AsyncGenerator<int> fetched_values(Scheduler& scheduler, int count, FlowCounters& counters)
+    {
+        DestructionFlag guard{counters.producer_destroyed};
+
+        for (int i = 0; i < count; ++i)
+        {
+            int value = co_await scheduler.fetch_data();
+            ++counters.produced;
+            co_yield value;
+        }
+    }
+
+    Task<int> slow_sum(Scheduler& scheduler, AsyncGenerator<int> values, FlowCounters& counters)
+    {
+        int sum = 0;
+        while (auto value = co_await values.next())
+        {
+            ++counters.consumed;
+            counters.max_in_flight = std::max(counters.max_in_flight, counters.produced - counters.consumed + 1);
+
+            co_await scheduler.sleep_for(1ms); // slow consumer
+            sum += *value;
+        }
+        co_return sum;
+    }
+
+    AsyncGenerator<std::string> lines(Scheduler& scheduler, std::vector<std::string> input)
+    {
+        for (auto& line : input)
+        {
+            co_await scheduler.fetch_data(); // e.g. reading the next block
+            co_yield std::move(line);
+        }
+    }
+
+    AsyncGenerator<int> parse(AsyncGenerator<std::string> input)
+    {
+        while (auto line = co_await input.next())
+        {
+            if (line->empty())
+                continue;
+            co_yield std::stoi(*line);
+        }
+    }
+
+    AsyncGenerator<int> enrich(Scheduler& scheduler, AsyncGenerator<int> input)
+    {
+        while (auto value = co_await input.next())
+        {
+            co_await scheduler.fetch_data();
+            co_yield *value * 10;
+        }
+    }
+
+    template <typename T>
+    Task<std::vector<T>> collect(AsyncGenerator<T> input)
+    {
+        std::vector<T> result;
+        while (auto value = co_await input.next())
+            result.push_back(std::move(*value));
+        co_return result;
+    }
+} // namespace
+
+TEST_CASE("AsyncGenerator - producer co_awaits, consumer pulls", "[coroutines][async_generator]")
+{
+    Scheduler scheduler;
+    FlowCounters counters;
+
+    auto consumer = slow_sum(scheduler, fetched_values(scheduler, 20, counters), counters);
+    scheduler.submit_task(consumer);
+    scheduler.run();
+
+    CHECK(consumer.result() >= 20);
+    CHECK(counters.produced == 20);
+    CHECK(counters.consumed == 20);
+    CHECK(counters.max_in_flight == 1); // the producer never runs ahead of the consumer
+    CHECK(counters.producer_destroyed);
+}
+
+TEST_CASE("AsyncGenerator - multi-stage pipeline", "[coroutines][async_generator]")
+{
+    Scheduler scheduler;
+
+    auto pipeline = collect(enrich(scheduler, parse(lines(scheduler, {"1", "", "2", "3", "", "4"}))));
+    scheduler.submit_task(pipeline);
+    scheduler.run();
+
+    CHECK(pipeline.result() == std::vector{10, 20, 30, 40});
+}
+
+TEST_CASE("AsyncGenerator - early exit and errors", "[coroutines][async_generator]")
+{
+    Scheduler scheduler;
+
+    SECTION("consumer stops early - the producer is destroyed")
+    {
+        FlowCounters counters;
+
+        {
+            auto consumer = [](AsyncGenerator<int> values) -> Task<int> {
+                int first = *co_await values.next();
+                co_await values.next();
+                co_return first;
+            }(fetched_values(scheduler, 1'000, counters));
+
+            scheduler.submit_task(consumer);
+            scheduler.run();
+
+            CHECK(counters.produced == 2);
+            CHECK_FALSE(counters.producer_destroyed); // suspended at co_yield, owned by the consumer's frame
+        }
+
+        CHECK(counters.producer_destroyed);
+    }
+
+    SECTION("exception thrown by the producer")
+    {
+        auto consumer = collect(parse(lines(scheduler, {"1", "two", "3"})));
+        scheduler.submit_task(consumer);
+        scheduler.run();
+
+        CHECK_THROWS_AS(consumer.result(), std::invalid_argument);
+    }
+
+    SECTION("empty stream")
+    {
+        auto consumer = collect(lines(scheduler, {}));
+        scheduler.submit_task(consumer);
+        scheduler.run();
+
+        CHECK(consumer.result().empty());
+    }
+}
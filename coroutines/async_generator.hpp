@@ -0,0 +1,134 @@
+#ifndef ASYNC_GENERATOR_HPP
+#define ASYNC_GENERATOR_HPP
+
+#include "task.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+// Asynchronous stream produced by a coroutine that may both co_await (fetch_data(), I/O, other tasks) and co_yield:
+//   while (auto value = co_await stream.next())
+//       process(*value);
+//  - backpressure - the producer runs only on demand: co_await next() resumes it, co_yield suspends it and resumes
+//    the consumer with the value (symmetric transfer), so at most one element is ever in flight
+//  - the producer runs on the scheduler of its consumer and inherits its stop token and scheduling (like Task<T>)
+//  - an exception thrown by the producer is rethrown from co_await next(); std::nullopt at the end of the stream
+//  - stages of a pipeline take the previous stage by value: AsyncGenerator<U> stage(AsyncGenerator<T> input)
+template <typename T>
+class AsyncGenerator
+{
+public:
+    class promise_type : public TaskPromiseBase
+    {
+    public:
+        AsyncGenerator get_return_object()
+        {
+            return AsyncGenerator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        struct YieldAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> coro_handle) noexcept
+            {
+                return coro_handle.promise().continuation;
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        template <typename TValue = T>
+        YieldAwaiter yield_value(TValue&& value)
+        {
+            value_.emplace(std::forward<TValue>(value));
+            return {};
+        }
+
+        void return_void() noexcept { }
+
+        void unhandled_exception() noexcept
+        {
+            exception_ = std::current_exception();
+        }
+
+    private:
+        friend class AsyncGenerator;
+
+        std::optional<T> value_; // the element handed over to the consumer
+        std::exception_ptr exception_;
+    };
+
+    AsyncGenerator(AsyncGenerator&& other) noexcept
+        : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+    { }
+
+    AsyncGenerator& operator=(AsyncGenerator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (coro_handle_)
+                coro_handle_.destroy();
+            coro_handle_ = std::exchange(other.coro_handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~AsyncGenerator()
+    {
+        if (coro_handle_)
+            coro_handle_.destroy();
+    }
+
+    // co_await stream.next() - the next element (std::nullopt when the stream has ended)
+    [[nodiscard]] auto next() noexcept
+    {
+        return NextAwaiter{coro_handle_};
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_handle_;
+
+    explicit AsyncGenerator(std::coroutine_handle<promise_type> coro_handle)
+        : coro_handle_{coro_handle}
+    { }
+
+    struct NextAwaiter
+    {
+        std::coroutine_handle<promise_type> coro_handle;
+
+        bool await_ready() const noexcept
+        {
+            return !coro_handle || coro_handle.done();
+        }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            promise_type& promise = coro_handle.promise();
+            promise.value_.reset();
+            promise.continuation = awaiting_coro;
+            promise.inherit_from(awaiting_coro);
+            return coro_handle;
+        }
+
+        std::optional<T> await_resume()
+        {
+            if (!coro_handle)
+                return std::nullopt;
+
+            promise_type& promise = coro_handle.promise();
+            if (promise.exception_)
+                std::rethrow_exception(std::exchange(promise.exception_, nullptr));
+
+            if (coro_handle.done())
+                return std::nullopt;
+
+            return std::move(promise.value_);
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,267 @@
+#include "async_primitives.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct SharedState
+    {
+        int value = 0;
+        int holders = 0;
+        int max_holders = 0;
+    };
+
+    // suspends while holding the mutex - other coroutines keep running on the scheduler thread
+    Task<> increment_slowly(Scheduler& scheduler, AsyncMutex& mutex, SharedState& state, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            co_await mutex.lock();
+            state.max_holders = std::max(state.max_holders, ++state.holders);
+
+            const int value = state.value;
+            co_await scheduler.fetch_data();
+            state.value = value + 1;
+
+            --state.holders;
+            mutex.unlock();
+        }
+    }
+
+    Task<> increment(AsyncMutex& mutex, int& value, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            std::unique_lock lk = co_await mutex.scoped_lock();
+            ++value;
+        }
+    }
+} // namespace
+
+TEST_CASE("AsyncMutex", "[coroutines][async_mutex]")
+{
+    SECTION("try_lock")
+    {
+        Scheduler scheduler;
+        AsyncMutex mutex{scheduler};
+
+        CHECK(mutex.try_lock());
+        CHECK_FALSE(mutex.try_lock());
+        mutex.unlock();
+        CHECK(mutex.try_lock());
+        mutex.unlock();
+    }
+
+    SECTION("mutual exclusion across suspension points")
+    {
+        Scheduler scheduler;
+        AsyncMutex mutex{scheduler};
+        SharedState state;
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 10; ++i)
+            tasks.push_back(increment_slowly(scheduler, mutex, state, 20));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(state.value == 200);
+        CHECK(state.max_holders == 1);
+        CHECK(mutex.try_lock());
+    }
+
+    SECTION("work stealing scheduler")
+    {
+        WorkStealingScheduler scheduler{4};
+        AsyncMutex mutex{scheduler};
+        int value = 0;
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 8; ++i)
+            tasks.push_back(increment(mutex, value, 10'000));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(value == 80'000);
+    }
+}
+
+namespace
+{
+    Task<> use_permit(Scheduler& scheduler, AsyncSemaphore& semaphore, SharedState& state)
+    {
+        co_await semaphore.acquire();
+        state.max_holders = std::max(state.max_holders, ++state.holders);
+
+        co_await scheduler.fetch_data();
+        ++state.value;
+
+        --state.holders;
+        semaphore.release();
+    }
+} // namespace
+
+TEST_CASE("AsyncSemaphore", "[coroutines][async_semaphore]")
+{
+    Scheduler scheduler;
+
+    SECTION("limits the number of concurrent holders")
+    {
+        AsyncSemaphore semaphore{scheduler, 3};
+        SharedState state;
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 10; ++i)
+            tasks.push_back(use_permit(scheduler, semaphore, state));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(state.value == 10);
+        CHECK(state.max_holders == 3);
+        CHECK(semaphore.available() == 3);
+    }
+
+    SECTION("release of many permits wakes many waiters")
+    {
+        AsyncSemaphore semaphore{scheduler, 0};
+        SharedState state;
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 4; ++i)
+            tasks.push_back(use_permit(scheduler, semaphore, state));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+
+        auto releaser = [](AsyncSemaphore& semaphore) -> Task<> {
+            semaphore.release(4);
+            co_return;
+        }(semaphore);
+        scheduler.submit_task(releaser);
+        scheduler.run();
+
+        CHECK(state.value == 4);
+        CHECK(state.max_holders == 4);
+    }
+}
+
+namespace
+{
+    Task<> worker(Scheduler& scheduler, AsyncLatch& latch, int& done)
+    {
+        co_await scheduler.fetch_data();
+        ++done;
+        latch.count_down();
+    }
+
+    Task<int> wait_for_workers(AsyncLatch& latch, int& done)
+    {
+        co_await latch.wait();
+        co_return done;
+    }
+} // namespace
+
+TEST_CASE("AsyncLatch", "[coroutines][async_latch]")
+{
+    Scheduler scheduler;
+
+    SECTION("waiters are released when the count reaches zero")
+    {
+        AsyncLatch latch{scheduler, 5};
+        int done = 0;
+
+        std::vector<Task<int>> waiters;
+        waiters.push_back(wait_for_workers(latch, done));
+        waiters.push_back(wait_for_workers(latch, done));
+        std::vector<Task<>> workers;
+        for (int i = 0; i < 5; ++i)
+            workers.push_back(worker(scheduler, latch, done));
+
+        for (auto& task : waiters)
+            scheduler.submit_task(task);
+        for (auto& task : workers)
+            scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(latch.try_wait());
+        CHECK(waiters[0].result() == 5);
+        CHECK(waiters[1].result() == 5);
+    }
+
+    SECTION("waiting for a released latch does not suspend")
+    {
+        AsyncLatch latch{scheduler, 0};
+        int done = 7;
+
+        auto waiter = wait_for_workers(latch, done);
+        scheduler.submit_task(waiter);
+        scheduler.run();
+
+        CHECK(waiter.result() == 7);
+    }
+}
+
+TEST_CASE("AsyncMutex vs std::mutex - contended counter", "[.][benchmark][async_mutex]")
+{
+    constexpr int thread_count = 4;
+    constexpr int increments = 10'000;
+
+    BENCHMARK("std::mutex - 4 threads")
+    {
+        std::mutex mtx;
+        int value = 0;
+        {
+            std::vector<std::jthread> threads;
+            for (int t = 0; t < thread_count; ++t)
+                threads.emplace_back([&] {
+                    for (int i = 0; i < increments; ++i)
+                    {
+                        std::lock_guard lk{mtx};
+                        ++value;
+                    }
+                });
+        }
+        return value;
+    };
+
+    BENCHMARK("AsyncMutex - work stealing scheduler, 4 workers")
+    {
+        WorkStealingScheduler scheduler{thread_count};
+        AsyncMutex mutex{scheduler};
+        int value = 0;
+
+        std::vector<Task<>> tasks;
+        for (int t = 0; t < thread_count; ++t)
+            tasks.push_back(increment(mutex, value, increments));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+        return value;
+    };
+
+    BENCHMARK("AsyncMutex - single threaded scheduler")
+    {
+        Scheduler scheduler;
+        AsyncMutex mutex{scheduler};
+        int value = 0;
+
+        std::vector<Task<>> tasks;
+        for (int t = 0; t < thread_count; ++t)
+            tasks.push_back(increment(mutex, value, increments));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+        return value;
+    };
+}
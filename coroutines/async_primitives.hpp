@@ -0,0 +1,346 @@
+#ifndef ASYNC_PRIMITIVES_HPP
+#define ASYNC_PRIMITIVES_HPP
+
+#include "scheduler_ref.hpp"
+#include "task.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+// Synchronization of coroutines - acquiring suspends the awaiting coroutine instead of blocking the scheduler thread:
+//  - every awaiter is a node of an intrusive list of waiters (no allocations)
+//  - a released waiter is handed back to the scheduler (submit_coro()) - it never runs inside unlock()/release()
+
+namespace details
+{
+    struct AsyncWaiter
+    {
+        std::coroutine_handle<> coro_handle = nullptr;
+        TaskScheduling scheduling;
+        AsyncWaiter* next = nullptr;
+
+        template <typename TPromise>
+        void prepare(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            coro_handle = awaiting_coro;
+            scheduling = scheduling_of(awaiting_coro);
+        }
+    };
+
+    // hands a list of released waiters back to the scheduler
+    inline void submit_all(SchedulerRef scheduler, AsyncWaiter* waiter)
+    {
+        while (waiter)
+        {
+            AsyncWaiter* next = waiter->next; // the awaiter is gone once its coroutine runs
+            scheduler.submit(waiter->coro_handle, waiter->scheduling);
+            waiter = next;
+        }
+    }
+
+    inline AsyncWaiter* reverse(AsyncWaiter* stack) noexcept
+    {
+        AsyncWaiter* list = nullptr;
+        while (stack)
+        {
+            AsyncWaiter* next = stack->next;
+            stack->next = list;
+            list = stack;
+            stack = next;
+        }
+        return list;
+    }
+} // namespace details
+
+// Lock-free mutex for coroutines:
+//   co_await mutex.lock(); ... mutex.unlock();
+//   std::unique_lock lk = co_await mutex.scoped_lock();
+// unlock() passes the ownership directly to the first waiter (FIFO) - it may be called on any thread
+class AsyncMutex
+{
+    struct LockAwaiter : details::AsyncWaiter
+    {
+        AsyncMutex& mutex;
+
+        explicit LockAwaiter(AsyncMutex& mutex) noexcept
+            : mutex{mutex}
+        { }
+
+        bool await_ready() noexcept { return mutex.try_lock(); }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            prepare(awaiting_coro);
+            return mutex.lock_or_enqueue(*this);
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+    struct ScopedLockAwaiter : LockAwaiter
+    {
+        using LockAwaiter::LockAwaiter;
+
+        std::unique_lock<AsyncMutex> await_resume() const noexcept
+        {
+            return std::unique_lock<AsyncMutex>{mutex, std::adopt_lock};
+        }
+    };
+
+public:
+    explicit AsyncMutex(SchedulerRef scheduler)
+        : scheduler_{scheduler}
+    { }
+
+    AsyncMutex(const AsyncMutex&) = delete;
+    AsyncMutex& operator=(const AsyncMutex&) = delete;
+
+    bool try_lock() noexcept
+    {
+        std::uintptr_t expected = not_locked;
+        return state_.compare_exchange_strong(expected, locked_no_waiters, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    // co_await mutex.lock() - resumes as the owner of the mutex
+    [[nodiscard]] LockAwaiter lock() noexcept
+    {
+        return LockAwaiter{*this};
+    }
+
+    // co_await mutex.scoped_lock() - std::unique_lock owning the mutex
+    [[nodiscard]] ScopedLockAwaiter scoped_lock() noexcept
+    {
+        return ScopedLockAwaiter{*this};
+    }
+
+    void unlock()
+    {
+        details::AsyncWaiter* waiter = waiters_;
+        if (!waiter)
+        {
+            std::uintptr_t expected = locked_no_waiters;
+            if (state_.compare_exchange_strong(expected, not_locked, std::memory_order_release, std::memory_order_relaxed))
+                return;
+
+            // coroutines suspended since the last unlock() - a LIFO stack
+            waiter = details::reverse(reinterpret_cast<details::AsyncWaiter*>(state_.exchange(locked_no_waiters, std::memory_order_acq_rel)));
+        }
+
+        waiters_ = waiter->next;
+        scheduler_.submit(waiter->coro_handle, waiter->scheduling); // the waiter owns the mutex now
+    }
+
+private:
+    static constexpr std::uintptr_t locked_no_waiters = 0;
+    static constexpr std::uintptr_t not_locked = 1;
+
+    SchedulerRef scheduler_;
+    std::atomic<std::uintptr_t> state_{not_locked}; // not_locked, locked_no_waiters or a stack of new waiters
+    details::AsyncWaiter* waiters_ = nullptr; // FIFO of waiters - accessed only by the owner
+
+    // false - the mutex has been acquired after all
+    bool lock_or_enqueue(LockAwaiter& awaiter) noexcept
+    {
+        std::uintptr_t state = state_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (state == not_locked)
+            {
+                if (state_.compare_exchange_weak(state, locked_no_waiters, std::memory_order_acquire, std::memory_order_relaxed))
+                    return false;
+            }
+            else
+            {
+                awaiter.next = reinterpret_cast<details::AsyncWaiter*>(state);
+                if (state_.compare_exchange_weak(state, reinterpret_cast<std::uintptr_t>(static_cast<details::AsyncWaiter*>(&awaiter)),
+                        std::memory_order_release, std::memory_order_relaxed))
+                    return true;
+            }
+        }
+    }
+};
+
+// Counting semaphore for coroutines - co_await semaphore.acquire() suspends while no permits are available;
+// release() hands permits to the waiters in FIFO order
+class AsyncSemaphore
+{
+    struct AcquireAwaiter : details::AsyncWaiter
+    {
+        AsyncSemaphore& semaphore;
+
+        explicit AcquireAwaiter(AsyncSemaphore& semaphore) noexcept
+            : semaphore{semaphore}
+        { }
+
+        bool await_ready() { return semaphore.try_acquire(); }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            prepare(awaiting_coro);
+            return semaphore.acquire_or_enqueue(*this);
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+public:
+    AsyncSemaphore(SchedulerRef scheduler, std::size_t initial_count)
+        : scheduler_{scheduler}
+        , count_{initial_count}
+    { }
+
+    AsyncSemaphore(const AsyncSemaphore&) = delete;
+    AsyncSemaphore& operator=(const AsyncSemaphore&) = delete;
+
+    bool try_acquire()
+    {
+        std::lock_guard lk{mtx_};
+        if (count_ == 0)
+            return false;
+        --count_;
+        return true;
+    }
+
+    // co_await semaphore.acquire() - resumes holding a permit
+    [[nodiscard]] AcquireAwaiter acquire() noexcept
+    {
+        return AcquireAwaiter{*this};
+    }
+
+    void release(std::size_t count = 1)
+    {
+        details::AsyncWaiter* released = nullptr;
+        details::AsyncWaiter** released_tail = &released;
+        {
+            std::lock_guard lk{mtx_};
+            count_ += count;
+            while (count_ > 0 && head_)
+            {
+                details::AsyncWaiter* waiter = std::exchange(head_, head_->next);
+                waiter->next = nullptr;
+                *std::exchange(released_tail, &waiter->next) = waiter;
+                --count_;
+            }
+            if (!head_)
+                tail_ = nullptr;
+        }
+
+        details::submit_all(scheduler_, released);
+    }
+
+    std::size_t available() const
+    {
+        std::lock_guard lk{mtx_};
+        return count_;
+    }
+
+private:
+    SchedulerRef scheduler_;
+    mutable std::mutex mtx_; // never held across a suspension
+    std::size_t count_;
+    details::AsyncWaiter* head_ = nullptr;
+    details::AsyncWaiter* tail_ = nullptr;
+
+    bool acquire_or_enqueue(AcquireAwaiter& awaiter)
+    {
+        std::lock_guard lk{mtx_};
+        if (count_ > 0)
+        {
+            --count_;
+            return false;
+        }
+
+        awaiter.next = nullptr;
+        (tail_ ? tail_->next : head_) = &awaiter;
+        tail_ = &awaiter;
+        return true;
+    }
+};
+
+// Single-use countdown for coroutines - co_await latch.wait() suspends until count_down() has been called
+// expected times; all waiters are released at once
+class AsyncLatch
+{
+    struct WaitAwaiter : details::AsyncWaiter
+    {
+        AsyncLatch& latch;
+
+        explicit WaitAwaiter(AsyncLatch& latch) noexcept
+            : latch{latch}
+        { }
+
+        bool await_ready() const noexcept { return latch.try_wait(); }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            prepare(awaiting_coro);
+            return latch.enqueue(*this);
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+public:
+    AsyncLatch(SchedulerRef scheduler, std::ptrdiff_t expected)
+        : scheduler_{scheduler}
+        , count_{expected}
+        , waiters_{expected > 0 ? nullptr : released()}
+    { }
+
+    AsyncLatch(const AsyncLatch&) = delete;
+    AsyncLatch& operator=(const AsyncLatch&) = delete;
+
+    void count_down(std::ptrdiff_t n = 1)
+    {
+        if (count_.fetch_sub(n, std::memory_order_acq_rel) != n)
+            return;
+
+        auto* waiters = static_cast<details::AsyncWaiter*>(waiters_.exchange(released(), std::memory_order_acq_rel));
+        details::submit_all(scheduler_, details::reverse(waiters));
+    }
+
+    bool try_wait() const noexcept
+    {
+        return count_.load(std::memory_order_acquire) <= 0;
+    }
+
+    // co_await latch.wait()
+    [[nodiscard]] WaitAwaiter wait() noexcept
+    {
+        return WaitAwaiter{*this};
+    }
+
+private:
+    SchedulerRef scheduler_;
+    std::atomic<std::ptrdiff_t> count_;
+    std::atomic<void*> waiters_; // stack of waiters or released()
+
+    void* released() noexcept
+    {
+        return this;
+    }
+
+    // false - the latch has been released in the meantime
+    bool enqueue(WaitAwaiter& awaiter) noexcept
+    {
+        void* state = waiters_.load(std::memory_order_acquire);
+        do
+        {
+            if (state == released())
+                return false;
+            awaiter.next = static_cast<details::AsyncWaiter*>(state);
+        } while (!waiters_.compare_exchange_weak(state, static_cast<details::AsyncWaiter*>(&awaiter),
+            std::memory_order_release, std::memory_order_acquire));
+
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,82 @@
+// the reporter headers only forward-declare BenchmarkStats (Catch2 >= 3.5) - its definition is included explicitly
+#if __has_include(<catch2/benchmark/detail/catch_benchmark_stats.hpp>)
+#include <catch2/benchmark/detail/catch_benchmark_stats.hpp>
+#endif
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/interfaces/catch_interfaces_reporter.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <catch2/reporters/catch_reporter_streaming_base.hpp>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // --reporter benchmark-json::out=file.json - the results of every benchmark (times in ns):
+    //   {"benchmarks": [{"test_case": ..., "name": ..., "samples": ..., "iterations": ...,
+    //                    "mean": {"point": ..., "lower_bound": ..., "upper_bound": ...}, "standard_deviation": {...},
+    //                    "outlier_variance": ...}, ...]}
+    // (the JSON reporter of Catch2 writes the test cases and assertions only, without the benchmark results)
+    class BenchmarkJsonReporter : public Catch::StreamingReporterBase
+    {
+    public:
+        using StreamingReporterBase::StreamingReporterBase;
+
+        static std::string getDescription()
+        {
+            return "Writes the statistics of benchmarks as JSON";
+        }
+
+        void testRunStarting(const Catch::TestRunInfo& info) override
+        {
+            StreamingReporterBase::testRunStarting(info);
+            m_stream << "{\n  \"benchmarks\": [";
+        }
+
+        void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+        {
+            m_stream << (first_benchmark_ ? "\n" : ",\n") << "    {"
+                     << "\"test_case\": " << quoted(currentTestCaseInfo ? currentTestCaseInfo->name : std::string{}) << ", "
+                     << "\"name\": " << quoted(stats.info.name) << ", "
+                     << "\"samples\": " << stats.info.samples << ", "
+                     << "\"iterations\": " << stats.info.iterations << ", "
+                     << "\"mean\": " << estimate(stats.mean) << ", "
+                     << "\"standard_deviation\": " << estimate(stats.standardDeviation) << ", "
+                     << "\"outlier_variance\": " << stats.outlierVariance << "}";
+            first_benchmark_ = false;
+        }
+
+        void testRunEnded(const Catch::TestRunStats& stats) override
+        {
+            m_stream << "\n  ]\n}\n";
+            StreamingReporterBase::testRunEnded(stats);
+        }
+
+    private:
+        bool first_benchmark_ = true;
+
+        static std::string quoted(std::string_view text)
+        {
+            std::string result = "\"";
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                    result += '\\';
+                if (static_cast<unsigned char>(c) < 0x20)
+                    result += ' ';
+                else
+                    result += c;
+            }
+            return result + '"';
+        }
+
+        template <typename TEstimate>
+        static std::string estimate(const TEstimate& value)
+        {
+            return "{\"point\": " + std::to_string(value.point.count()) + ", \"lower_bound\": " + std::to_string(value.lower_bound.count())
+                 + ", \"upper_bound\": " + std::to_string(value.upper_bound.count()) + "}";
+        }
+    };
+} // namespace
+
+CATCH_REGISTER_REPORTER("benchmark-json", BenchmarkJsonReporter)
@@ -0,0 +1,6 @@
+# cmake -DRESULTS=bench-coroutines.json -P check_benchmark_json.cmake - fails when the file has no benchmark measurements
+file(READ ${RESULTS} content)
+string(FIND "${content}" "\"mean\": {\"point\": " position)
+if(position EQUAL -1)
+  message(FATAL_ERROR "${RESULTS} contains no benchmark measurements")
+endif()
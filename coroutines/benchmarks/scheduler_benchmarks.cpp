@@ -0,0 +1,102 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // co_await yield(scheduler) - a round-trip through the ready queue of the scheduler
+    struct YieldAwaiter
+    {
+        Scheduler& scheduler;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> coro_handle)
+        {
+            scheduler.submit_coro(coro_handle);
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+    Task<> yielding(Scheduler& scheduler, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            YieldAwaiter awaiter{scheduler}; // named - GCC 12 destroys aggregate temporaries of co_await twice
+            co_await awaiter;
+        }
+    }
+
+    Task<int> fetching(Scheduler& scheduler, int count)
+    {
+        int sum = 0;
+        for (int i = 0; i < count; ++i)
+            sum += co_await scheduler.fetch_data();
+        co_return sum;
+    }
+
+    void run_all(Scheduler& scheduler, std::vector<Task<>>& tasks)
+    {
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+    }
+} // namespace
+
+TEST_CASE("Scheduler - awaiter round-trips", "[benchmark][scheduler]")
+{
+    Scheduler scheduler;
+
+    BENCHMARK("submit_coro + resume x10'000 (one coroutine)")
+    {
+        std::vector<Task<>> tasks;
+        tasks.push_back(yielding(scheduler, 10'000));
+        run_all(scheduler, tasks);
+    };
+
+    BENCHMARK("fetch_data x1'000 (one coroutine)")
+    {
+        auto task = fetching(scheduler, 1'000);
+        scheduler.submit_task(task);
+        scheduler.run();
+        return task.result();
+    };
+
+    BENCHMARK("fetch_data x10 (100 coroutines - batched)")
+    {
+        std::vector<Task<int>> tasks;
+        for (int i = 0; i < 100; ++i)
+            tasks.push_back(fetching(scheduler, 10));
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+        return tasks.size();
+    };
+}
+
+// cost per coroutine = reported time / live coroutines
+TEST_CASE("Scheduler - scaling with the number of live coroutines", "[benchmark][scheduler][scaling]")
+{
+    Scheduler scheduler;
+
+    for (std::size_t live : {1uz, 100uz, 10'000uz, 1'000'000uz})
+    {
+        BENCHMARK_ADVANCED("create + 1 round-trip + destroy - " + std::to_string(live) + " coroutines")(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                std::vector<Task<>> tasks;
+                tasks.reserve(live);
+                for (std::size_t i = 0; i < live; ++i)
+                    tasks.push_back(yielding(scheduler, 1));
+                run_all(scheduler, tasks);
+            });
+        };
+    }
+}
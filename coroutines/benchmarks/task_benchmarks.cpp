@@ -0,0 +1,75 @@
+#include "task.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace
+{
+    Task<int> immediate_value(int value)
+    {
+        co_return value;
+    }
+
+    Task<int> await_chain(int depth)
+    {
+        if (depth == 0)
+            co_return 0;
+        co_return 1 + co_await await_chain(depth - 1);
+    }
+
+    // a task submitted nowhere - resumed by hand, as a scheduler would
+    template <typename T>
+    decltype(auto) run_inline(Task<T>& task)
+    {
+        task.get_coro_handle().resume();
+        return task.result();
+    }
+} // namespace
+
+TEST_CASE("Task - lifecycle", "[benchmark][task]")
+{
+    BENCHMARK("create + destroy (never started)")
+    {
+        return immediate_value(42).get_coro_handle().address();
+    };
+
+    BENCHMARK("create + resume to completion + destroy")
+    {
+        auto task = immediate_value(42);
+        return run_inline(task);
+    };
+
+    BENCHMARK_ADVANCED("destroy only")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<std::optional<Task<int>>> tasks;
+        tasks.reserve(static_cast<std::size_t>(meter.runs()));
+        for (int i = 0; i < meter.runs(); ++i)
+            tasks.emplace_back(immediate_value(i));
+
+        meter.measure([&](int i) { tasks[static_cast<std::size_t>(i)].reset(); });
+    };
+}
+
+TEST_CASE("Task - co_await round-trip", "[benchmark][task]")
+{
+    BENCHMARK("co_await of a completed child task x1")
+    {
+        auto task = await_chain(1);
+        return run_inline(task);
+    };
+
+    BENCHMARK("co_await chain x10 (symmetric transfer)")
+    {
+        auto task = await_chain(10);
+        return run_inline(task);
+    };
+
+    BENCHMARK("co_await chain x1000 (symmetric transfer)")
+    {
+        auto task = await_chain(1000);
+        return run_inline(task);
+    };
+}
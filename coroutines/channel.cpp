@@ -0,0 +1,225 @@
+#include "channel.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("MpmcRing", "[coroutines][channel]")
+{
+    MpmcRing<std::unique_ptr<int>> ring{3};
+    CHECK(ring.capacity() == 4);
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(ring.try_push(std::make_unique<int>(i)));
+
+    auto rejected = std::make_unique<int>(4);
+    CHECK_FALSE(ring.try_push(std::move(rejected)));
+    CHECK(rejected); // not moved from
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto item = ring.try_pop();
+        REQUIRE(item);
+        CHECK(**item == i);
+    }
+
+    CHECK_FALSE(ring.try_pop());
+}
+
+TEST_CASE("MpmcRing - concurrent producers and consumers", "[coroutines][channel]")
+{
+    constexpr int producer_count = 4;
+    constexpr int items_per_producer = 100'000;
+
+    MpmcRing<int> ring{64};
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    {
+        std::vector<std::jthread> threads;
+        for (int p = 0; p < producer_count; ++p)
+            threads.emplace_back([&ring] {
+                for (int i = 1; i <= items_per_producer; ++i)
+                    while (!ring.try_push(i))
+                        std::this_thread::yield();
+            });
+
+        for (int c = 0; c < 4; ++c)
+            threads.emplace_back([&] {
+                while (consumed.load() < producer_count * items_per_producer)
+                {
+                    if (auto item = ring.try_pop())
+                    {
+                        sum += *item;
+                        ++consumed;
+                    }
+                    else
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    CHECK(consumed == producer_count * items_per_producer);
+    CHECK(sum == producer_count * (1LL * items_per_producer * (items_per_producer + 1) / 2));
+}
+
+namespace
+{
+    Task<> produce(Channel<std::string>& channel, std::vector<std::string> items)
+    {
+        for (auto& item : items)
+            co_await channel.send(std::move(item));
+        channel.close();
+    }
+
+    Task<std::vector<std::string>> consume(Channel<std::string>& channel)
+    {
+        std::vector<std::string> received;
+        while (auto item = co_await channel.receive())
+            received.push_back(std::move(*item));
+        co_return received;
+    }
+} // namespace
+
+TEST_CASE("Channel - single threaded scheduler", "[coroutines][channel]")
+{
+    Scheduler scheduler;
+
+    SECTION("values arrive in order through a channel smaller than the stream")
+    {
+        Channel<std::string> channel{scheduler, 2};
+
+        std::vector<std::string> items;
+        for (int i = 0; i < 100; ++i)
+            items.push_back("item#" + std::to_string(i));
+
+        auto consumer = consume(channel);
+        auto producer = produce(channel, items);
+        scheduler.submit_task(consumer);
+        scheduler.submit_task(producer);
+        scheduler.run();
+
+        CHECK(consumer.result() == items);
+    }
+
+    SECTION("send to a closed channel throws")
+    {
+        Channel<std::string> channel{scheduler, 2};
+        channel.close();
+
+        auto task = [](Channel<std::string>& channel) -> Task<> { co_await channel.send("text"); }(channel);
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK_THROWS_AS(task.result(), ChannelClosed);
+    }
+
+    SECTION("close wakes up suspended senders")
+    {
+        Channel<std::string> channel{scheduler, 2};
+
+        auto producer = produce(channel, std::vector<std::string>(10, "text"));
+        auto closer = [](Scheduler& scheduler, Channel<std::string>& channel) -> Task<std::optional<std::string>> {
+            co_await scheduler.sleep_for(1ms);
+            auto first = co_await channel.receive();
+            channel.close();
+            co_return first;
+        }(scheduler, channel);
+
+        scheduler.submit_task(producer);
+        scheduler.submit_task(closer);
+        scheduler.run();
+
+        CHECK(closer.result() == "text");
+        CHECK_THROWS_AS(producer.result(), ChannelClosed);
+    }
+}
+
+namespace
+{
+    struct Message
+    {
+        int producer;
+        int sequence;
+    };
+
+    Task<> stress_producer(Channel<Message>& channel, int producer, int count, std::atomic<int>& producers_left)
+    {
+        for (int i = 0; i < count; ++i)
+            co_await channel.send(Message{producer, i});
+
+        if (--producers_left == 0)
+            channel.close();
+    }
+
+    struct ConsumerLog
+    {
+        std::mutex mtx;
+        std::vector<std::vector<int>> received;
+        std::atomic<int> order_violations{0};
+    };
+
+    Task<> stress_consumer(Channel<Message>& channel, int producer_count, ConsumerLog& log)
+    {
+        std::vector<int> last_sequence(producer_count, -1);
+        std::vector<std::vector<int>> local(producer_count);
+
+        while (auto message = co_await channel.receive())
+        {
+            if (message->sequence <= last_sequence[message->producer]) // FIFO per producer
+                ++log.order_violations;
+            last_sequence[message->producer] = message->sequence;
+            local[message->producer].push_back(message->sequence);
+        }
+
+        std::lock_guard lk{log.mtx};
+        for (int p = 0; p < producer_count; ++p)
+            log.received[p].insert(log.received[p].end(), local[p].begin(), local[p].end());
+    }
+} // namespace
+
+TEST_CASE("Channel - many producers and consumers on the work stealing scheduler", "[coroutines][channel]")
+{
+    constexpr int producer_count = 8;
+    constexpr int consumer_count = 8;
+    constexpr int messages_per_producer = 20'000;
+
+    WorkStealingScheduler scheduler{4};
+    Channel<Message> channel{scheduler, 16};
+
+    std::atomic<int> producers_left{producer_count};
+    ConsumerLog log;
+    log.received.resize(producer_count);
+
+    std::vector<Task<>> tasks;
+    for (int c = 0; c < consumer_count; ++c)
+        tasks.push_back(stress_consumer(channel, producer_count, log));
+    for (int p = 0; p < producer_count; ++p)
+        tasks.push_back(stress_producer(channel, p, messages_per_producer, producers_left));
+
+    for (auto& task : tasks)
+        scheduler.submit_task(task);
+    scheduler.run();
+
+    CHECK(log.order_violations == 0);
+
+    // every message delivered exactly once
+    for (auto& sequences : log.received)
+    {
+        std::ranges::sort(sequences);
+        REQUIRE(sequences.size() == messages_per_producer);
+        for (int i = 0; i < messages_per_producer; ++i)
+            CHECK(sequences[i] == i);
+    }
+}
@@ -0,0 +1,459 @@
+#ifndef CHANNEL_HPP
+#define CHANNEL_HPP
+
+#include "scheduler_ref.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Bounded lock-free multi-producer/multi-consumer ring buffer (Vyukov) - every cell has a sequence number
+// telling producers and consumers whose turn it is, so a push/pop is a single CAS on the shared position
+template <typename T>
+class MpmcRing
+{
+public:
+    explicit MpmcRing(std::size_t capacity)
+        : capacity_{std::bit_ceil(std::max<std::size_t>(capacity, 2))}
+        , mask_{capacity_ - 1}
+        , cells_{std::make_unique<Cell[]>(capacity_)}
+    {
+        for (std::size_t i = 0; i < capacity_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    ~MpmcRing()
+    {
+        while (try_pop())
+            ;
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    // the value is moved from only when the push succeeds
+    template <typename TValue>
+    bool try_push(TValue&& value)
+    {
+        std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if (difference == 0)
+            {
+                if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    ::new (cell.storage) T(std::forward<TValue>(value));
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+                return false; // full
+            else
+                position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::optional<T> try_pop()
+    {
+        std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+
+            if (difference == 0)
+            {
+                if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    T* item = std::launder(reinterpret_cast<T*>(cell.storage));
+                    std::optional<T> value{std::move(*item)};
+                    item->~T();
+                    cell.sequence.store(position + capacity_, std::memory_order_release);
+                    return value;
+                }
+            }
+            else if (difference < 0)
+                return std::nullopt; // empty
+            else
+                position = dequeue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(64) std::atomic<std::size_t> enqueue_position_{0};
+    alignas(64) std::atomic<std::size_t> dequeue_position_{0};
+};
+
+// thrown by co_await channel.send() when the channel has been closed
+class ChannelClosed : public std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "channel closed";
+    }
+};
+
+// Bounded asynchronous channel:
+//  - co_await channel.send(value) - suspends while the channel is full
+//  - co_await channel.receive() - suspends while the channel is empty; std::nullopt when closed and drained
+//  - values travel through a lock-free MpmcRing; only suspending (the slow path) touches the waiter lists,
+//    which are guarded by a spin lock - a coroutine woken up gets its value (or its slot) handed over
+//    directly, so it never has to suspend again
+//  - suspended coroutines are resumed through the scheduler (submit_coro()) the channel was created with,
+//    keeping their TaskScheduling if the scheduler supports priorities
+template <typename T>
+class Channel
+{
+public:
+    Channel(SchedulerRef scheduler, std::size_t capacity)
+        : ring_{capacity}
+        , scheduler_{scheduler}
+    { }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    std::size_t capacity() const
+    {
+        return ring_.capacity();
+    }
+
+    [[nodiscard]] auto send(T value)
+    {
+        return SendAwaiter{*this, std::move(value)};
+    }
+
+    [[nodiscard]] auto receive()
+    {
+        return ReceiveAwaiter{*this};
+    }
+
+    // non-suspending variants
+    bool try_send(T& value)
+    {
+        if (closed_.load(std::memory_order_acquire) || !ring_.try_push(std::move(value)))
+            return false;
+        notify_receivers();
+        return true;
+    }
+
+    std::optional<T> try_receive()
+    {
+        std::optional<T> value = ring_.try_pop();
+        if (value)
+            notify_senders();
+        return value;
+    }
+
+    // wakes up all waiters - pending senders get ChannelClosed, receivers drain the remaining values
+    void close()
+    {
+        Waiters woken;
+        {
+            SpinLockGuard lk{waiters_lock_};
+            closed_.store(true, std::memory_order_release);
+            balance(woken);
+
+            for (auto* receiver = std::exchange(receivers_.head, nullptr); receiver; receiver = receiver->next)
+                woken.push_back(*receiver);
+            receivers_.tail = nullptr;
+            waiting_receivers_.store(0, std::memory_order_relaxed);
+
+            for (auto* sender = std::exchange(senders_.head, nullptr); sender; sender = sender->next)
+                woken.push_back(*sender);
+            senders_.tail = nullptr;
+            waiting_senders_.store(0, std::memory_order_relaxed);
+        }
+        resume_all(woken);
+    }
+
+    bool is_closed() const
+    {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Waiter
+    {
+        std::coroutine_handle<> coro_handle = nullptr;
+        TaskScheduling scheduling;
+    };
+
+    struct SendAwaiter : Waiter
+    {
+        Channel& channel;
+        T value;
+        bool sent = false;
+        SendAwaiter* next = nullptr;
+
+        SendAwaiter(Channel& channel, T value)
+            : channel{channel}
+            , value{std::move(value)}
+        { }
+
+        bool await_ready()
+        {
+            sent = channel.try_send(value);
+            return sent || channel.is_closed();
+        }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            this->coro_handle = awaiting_coro;
+            this->scheduling = scheduling_of(awaiting_coro);
+            return channel.suspend_sender(*this);
+        }
+
+        void await_resume() const
+        {
+            if (!sent)
+                throw ChannelClosed{};
+        }
+    };
+
+    struct ReceiveAwaiter : Waiter
+    {
+        Channel& channel;
+        std::optional<T> value;
+        ReceiveAwaiter* next = nullptr;
+
+        explicit ReceiveAwaiter(Channel& channel)
+            : channel{channel}
+        { }
+
+        bool await_ready()
+        {
+            value = channel.try_receive();
+            return value.has_value();
+        }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            this->coro_handle = awaiting_coro;
+            this->scheduling = scheduling_of(awaiting_coro);
+            return channel.suspend_receiver(*this);
+        }
+
+        std::optional<T> await_resume()
+        {
+            return std::move(value);
+        }
+    };
+
+    template <typename TWaiter>
+    struct WaiterList
+    {
+        TWaiter* head = nullptr;
+        TWaiter* tail = nullptr;
+
+        void push_back(TWaiter& waiter)
+        {
+            waiter.next = nullptr;
+            (tail ? tail->next : head) = &waiter;
+            tail = &waiter;
+        }
+
+        TWaiter* pop_front()
+        {
+            TWaiter* waiter = head;
+            head = waiter->next;
+            if (!head)
+                tail = nullptr;
+            return waiter;
+        }
+    };
+
+    class SpinLock
+    {
+    public:
+        void lock() noexcept
+        {
+            while (flag_.test_and_set(std::memory_order_acquire))
+            {
+                while (flag_.test(std::memory_order_relaxed))
+                    std::this_thread::yield();
+            }
+        }
+
+        void unlock() noexcept
+        {
+            flag_.clear(std::memory_order_release);
+        }
+
+    private:
+        std::atomic_flag flag_;
+    };
+
+    using SpinLockGuard = std::lock_guard<SpinLock>;
+    using Waiters = std::vector<Waiter>;
+
+    MpmcRing<T> ring_;
+    SchedulerRef scheduler_;
+
+    std::atomic<bool> closed_{false};
+    std::atomic<std::size_t> waiting_senders_{0};
+    std::atomic<std::size_t> waiting_receivers_{0};
+    SpinLock waiters_lock_;
+    WaiterList<SendAwaiter> senders_;
+    WaiterList<ReceiveAwaiter> receivers_;
+
+    // false - the value was sent after all (or the channel is closed), the sender does not suspend
+    bool suspend_sender(SendAwaiter& sender)
+    {
+        {
+            SpinLockGuard lk{waiters_lock_};
+
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                waiting_senders_.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (!ring_.try_push(std::move(sender.value))) // a receiver may have freed a slot in the meantime
+                {
+                    senders_.push_back(sender);
+                    return true;
+                }
+
+                waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+                sender.sent = true;
+            }
+        }
+
+        if (sender.sent)
+            notify_receivers();
+        return false;
+    }
+
+    bool suspend_receiver(ReceiveAwaiter& receiver)
+    {
+        {
+            SpinLockGuard lk{waiters_lock_};
+
+            waiting_receivers_.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            receiver.value = ring_.try_pop(); // a sender may have pushed a value in the meantime
+            if (!receiver.value && !closed_.load(std::memory_order_relaxed))
+            {
+                receivers_.push_back(receiver);
+                return true;
+            }
+
+            waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        if (receiver.value)
+            notify_senders();
+        return false;
+    }
+
+    // after a push - hands values over to suspended receivers
+    void notify_receivers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_receivers_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        wake_waiters();
+    }
+
+    // after a pop - moves values of suspended senders into the ring
+    void notify_senders()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_senders_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        wake_waiters();
+    }
+
+    void wake_waiters()
+    {
+        Waiters woken;
+        {
+            SpinLockGuard lk{waiters_lock_};
+            balance(woken);
+        }
+        resume_all(woken);
+    }
+
+    // under the lock: hand-offs until neither a receiver nor a sender can make progress
+    void balance(Waiters& woken)
+    {
+        bool progress = true;
+        while (progress)
+        {
+            progress = false;
+
+            while (receivers_.head)
+            {
+                std::optional<T> value = ring_.try_pop();
+                if (!value)
+                    break;
+
+                ReceiveAwaiter* receiver = receivers_.pop_front();
+                waiting_receivers_.fetch_sub(1, std::memory_order_relaxed);
+                receiver->value = std::move(value);
+                woken.push_back(*receiver);
+                progress = true;
+            }
+
+            while (senders_.head)
+            {
+                if (!ring_.try_push(std::move(senders_.head->value)))
+                    break;
+
+                SendAwaiter* sender = senders_.pop_front();
+                waiting_senders_.fetch_sub(1, std::memory_order_relaxed);
+                sender->sent = true;
+                woken.push_back(*sender);
+                progress = true;
+            }
+        }
+    }
+
+    void resume_all(const Waiters& woken)
+    {
+        for (const Waiter& waiter : woken)
+            scheduler_.submit(waiter.coro_handle, waiter.scheduling);
+    }
+};
+
+#endif
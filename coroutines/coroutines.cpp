@@ -1,142 +1,114 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <atomic>
 #include <catch2/catch_test_macros.hpp>
+#include <chrono>
 #include <coroutine>
 #include <format>
 #include <iostream>
-#include <queue>
-#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 using namespace std::literals;
 
-class Task
+Task<> async_coro(int id, Scheduler& scheduler)
 {
-public:
-    struct promise_type
-    {
-        Task get_return_object()
-        {
-            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
-        }
-
-        std::suspend_always initial_suspend() { return {}; }
-        std::suspend_always final_suspend() noexcept { return {}; }
-        void return_void() { }
-        void unhandled_exception() { std::terminate(); }
-    };
-    
-    Task(std::coroutine_handle<promise_type> coro_handle)
-        : coro_handle_{coro_handle}
-    { }
+    std::cout << std::format("async_coro#{} start", id) << std::endl;
 
-    Task(const Task&) = delete;
-    Task& operator=(const Task&) = delete;
+    int value1 = co_await scheduler.fetch_data();
+    std::cout << std::format("async_coro#{} got value: {}", id, value1) << std::endl;
 
-    Task(Task&& other)
-        : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
-    { }
+    std::cout << "async_coro middle" << std::endl;
 
-    ~Task()
-    {
-        if (coro_handle_)
-            coro_handle_.destroy();
-    }
+    int value2 = co_await scheduler.fetch_data();
+    std::cout << std::format("async_coro#{} got value: {}", id, value2) << std::endl;
 
-    auto get_coro_handle() const
-    {
-        return coro_handle_;
-    }
+    std::cout << std::format("async_coro#{} end", id) << std::endl;
 
-private:
-    std::coroutine_handle<promise_type> coro_handle_;
-};
+    co_return;
+}
 
-class Scheduler
+TEST_CASE("first coroutine")
 {
-public:
-    void submit_coro(auto coro_handle)
-    {
-        suspended_coroutines_.push(coro_handle);
-    }
+    Scheduler scheduler;
 
-    void submit_task(Task& task)
-    {
-        suspended_coroutines_.push(task.get_coro_handle());
-    }
+    Task<> task1 = async_coro(1, scheduler);
+    Task<> task2 = async_coro(2, scheduler);
+    Task<> task3 = async_coro(3, scheduler);
+
+    scheduler.submit_task(task1);
+    scheduler.submit_task(task2);
+    scheduler.submit_task(task3);
+
+    scheduler.run();
+}
+
+// result delivered by another thread - the awaiting coroutine is re-enqueued only when it arrives
+class ExternalEvent
+{
+public:
+    explicit ExternalEvent(Scheduler& scheduler)
+        : scheduler_{scheduler}
+    { }
 
-    auto fetch_data()
+    auto operator co_await()
     {
-        struct ValueAwaiter
+        struct EventAwaiter
         {
-            Scheduler& scheduler;
+            ExternalEvent& event;
 
-            bool await_ready() { return false; }
+            bool await_ready() const noexcept { return false; }
 
             void await_suspend(std::coroutine_handle<> coro_handle)
             {
-                scheduler.submit_coro(coro_handle);
+                event.waiter_.store(coro_handle.address(), std::memory_order_release);
+                event.waiter_.notify_one();
             }
 
-            int await_resume()
-            {
-                std::random_device rd;
-                std::mt19937 rnd_gen(rd());
-                std::uniform_int_distribution<> distr(1, 100);
-                return distr(rnd_gen);
-            }
+            int await_resume() const noexcept { return event.value_; }
         };
 
-        return ValueAwaiter{*this};
+        return EventAwaiter{*this};
     }
 
-    void run()
+    void set(int value)
     {
-        while (!suspended_coroutines_.empty())
-        {
-            auto coro_handle = suspended_coroutines_.front();
-            suspended_coroutines_.pop();
+        waiter_.wait(nullptr, std::memory_order_acquire);
 
-            if (!coro_handle.done())
-            {
-                coro_handle.resume();
-                suspended_coroutines_.push(coro_handle);
-            }
-        }
+        value_ = value;
+        scheduler_.submit_coro(std::coroutine_handle<>::from_address(waiter_.load()));
     }
 
 private:
-    std::queue<std::coroutine_handle<void>> suspended_coroutines_;
+    Scheduler& scheduler_;
+    std::atomic<void*> waiter_{nullptr};
+    int value_ = 0;
 };
 
-Task async_coro(int id, Scheduler& scheduler)
+Task<> waiting_coro(ExternalEvent& event, int& result)
 {
-    std::cout << std::format("async_coro#{} start", id) << std::endl;
-
-    int value1 = co_await scheduler.fetch_data();
-    std::cout << std::format("async_coro#{} got value: {}", id, value1) << std::endl;
-
-    std::cout << "async_coro middle" << std::endl;
-
-    int value2 = co_await scheduler.fetch_data();
-    std::cout << std::format("async_coro#{} got value: {}", id, value2) << std::endl;
-
-    std::cout << std::format("async_coro#{} end", id) << std::endl;
-
-    co_return;
+    result = co_await event;
 }
 
-TEST_CASE("first coroutine")
+TEST_CASE("scheduler resumes coroutines only when their results are available")
 {
     Scheduler scheduler;
+    ExternalEvent event{scheduler};
+    int result = 0;
 
-    Task task1 = async_coro(1, scheduler);
-    Task task2 = async_coro(2, scheduler);
-    Task task3 = async_coro(3, scheduler);
+    Task<> task = waiting_coro(event, result);
+    scheduler.submit_task(task);
 
-    scheduler.submit_task(task1);
-    scheduler.submit_task(task2);
-    scheduler.submit_task(task3);
+    std::jthread producer{[&event] {
+        std::this_thread::sleep_for(50ms); // scheduler parks meanwhile
+        event.set(42);
+    }};
 
     scheduler.run();
+
+    CHECK(result == 42);
+    CHECK(scheduler.resume_count() == 2); // start + single resumption after the event
 }
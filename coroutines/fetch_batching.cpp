@@ -0,0 +1,102 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    Task<> fetch_twice(Scheduler& scheduler, std::vector<int>& values)
+    {
+        values.push_back(co_await scheduler.fetch_data());
+        values.push_back(co_await scheduler.fetch_data());
+    }
+
+    Task<> fetch_after(Scheduler& scheduler, std::chrono::milliseconds delay, std::vector<int>& values)
+    {
+        co_await scheduler.sleep_for(delay);
+        values.push_back(co_await scheduler.fetch_data());
+    }
+
+    void run_all(Scheduler& scheduler, std::vector<Task<>>& tasks)
+    {
+        for (auto& task : tasks)
+            scheduler.submit_task(task);
+        scheduler.run();
+    }
+} // namespace
+
+TEST_CASE("fetch_data - requests of a tick are coalesced", "[coroutines][fetch_data]")
+{
+    std::vector<int> values;
+
+    SECTION("default batching")
+    {
+        Scheduler scheduler;
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 100; ++i)
+            tasks.push_back(fetch_twice(scheduler, values));
+        run_all(scheduler, tasks);
+
+        const auto& stats = scheduler.fetch_stats();
+        CHECK(stats.requests == 200);
+        CHECK(stats.batches == 4); // 64 + 36 in each of two ticks
+        CHECK(stats.largest_batch == 64);
+        CHECK(stats.full_batches == 2);
+        CHECK(stats.average_batch_size() == 50.0);
+    }
+
+    SECTION("max batch size")
+    {
+        Scheduler scheduler{IoBackend::automatic, FetchBatching{.max_batch_size = 10}};
+
+        std::vector<Task<>> tasks;
+        for (int i = 0; i < 25; ++i)
+            tasks.push_back(fetch_twice(scheduler, values));
+        run_all(scheduler, tasks);
+
+        const auto& stats = scheduler.fetch_stats();
+        CHECK(stats.requests == 50);
+        CHECK(stats.batches == 6);
+        CHECK(stats.full_batches == 4);
+        CHECK(stats.largest_batch == 10);
+    }
+
+    SECTION("linger lets requests from later ticks join the batch")
+    {
+        Scheduler scheduler{IoBackend::automatic, FetchBatching{.max_batch_size = 64, .max_linger = 50ms}};
+
+        std::vector<Task<>> tasks;
+        tasks.push_back(fetch_after(scheduler, 0ms, values));
+        tasks.push_back(fetch_after(scheduler, 5ms, values));
+        tasks.push_back(fetch_after(scheduler, 10ms, values));
+        run_all(scheduler, tasks);
+
+        const auto& stats = scheduler.fetch_stats();
+        CHECK(stats.batches == 1);
+        CHECK(stats.requests == 3);
+        CHECK(stats.total_linger >= 50ms);
+    }
+
+    SECTION("without linger every tick gets its own batch")
+    {
+        Scheduler scheduler;
+
+        std::vector<Task<>> tasks;
+        tasks.push_back(fetch_after(scheduler, 0ms, values));
+        tasks.push_back(fetch_after(scheduler, 5ms, values));
+        run_all(scheduler, tasks);
+
+        CHECK(scheduler.fetch_stats().batches == 2);
+    }
+
+    for (int value : values)
+    {
+        CHECK(value >= 1);
+        CHECK(value <= 100);
+    }
+}
@@ -0,0 +1,201 @@
+#include "frame_pool.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    Task<> empty_coro()
+    {
+        co_return;
+    }
+
+    Task<> arena_coro(std::allocator_arg_t, FramePool&, int& counter)
+    {
+        ++counter;
+        co_return;
+    }
+
+    Task<> arena_fetch_coro(std::allocator_arg_t, FramePool&, Scheduler& scheduler, int& sum)
+    {
+        sum += co_await scheduler.fetch_data();
+    }
+} // namespace
+
+TEST_CASE("frame pool - size classes", "[coroutines][frame_pool]")
+{
+    FramePool pool;
+
+    void* block = pool.allocate(100);
+    CHECK(pool.stats().misses == 1);
+    pool.deallocate(block, 100);
+    CHECK(pool.stats().cached_blocks == 1);
+
+    SECTION("the same size class reuses the cached block")
+    {
+        void* other = pool.allocate(128);
+        CHECK(other == block);
+        CHECK(pool.stats().hits == 1);
+        pool.deallocate(other, 128);
+    }
+
+    SECTION("other size class misses")
+    {
+        void* other = pool.allocate(129);
+        CHECK(pool.stats().misses == 2);
+        pool.deallocate(other, 129);
+    }
+
+    SECTION("oversized requests bypass the pool")
+    {
+        void* big = pool.allocate(FramePool::max_pooled_size + 1);
+        pool.deallocate(big, FramePool::max_pooled_size + 1);
+        CHECK(pool.stats().misses == 2);
+        CHECK(pool.stats().cached_blocks == 1);
+    }
+}
+
+TEST_CASE("frame pool - Task frames are recycled", "[coroutines][frame_pool]")
+{
+    empty_coro(); // warm up the thread-local pool
+    FramePool::local().reset_stats();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Task<> task = empty_coro();
+        task.get_coro_handle().resume();
+    }
+
+    CHECK(FramePool::local().stats().hits == 10);
+    CHECK(FramePool::local().stats().misses == 0);
+}
+
+TEST_CASE("frame pool - per scheduler arena passed as a coroutine argument", "[coroutines][frame_pool]")
+{
+    Scheduler scheduler;
+    FramePool& arena = scheduler.frame_arena();
+
+    int counter = 0;
+    {
+        Task<> task = arena_coro(std::allocator_arg, arena, counter);
+        task.get_coro_handle().resume();
+    }
+    {
+        Task<> task = arena_coro(std::allocator_arg, arena, counter);
+        task.get_coro_handle().resume();
+    }
+
+    CHECK(counter == 2);
+    CHECK(arena.stats().misses == 1);
+    CHECK(arena.stats().hits == 1);
+
+    int sum = 0;
+    {
+        Task<> task = arena_fetch_coro(std::allocator_arg, arena, scheduler, sum);
+        scheduler.submit_task(task);
+        scheduler.run();
+    }
+    CHECK(sum > 0);
+    CHECK(arena.stats().cached_blocks >= 1);
+}
+
+namespace
+{
+    // the same coroutine type without frame pooling - baseline for the benchmark
+    class HeapTask
+    {
+    public:
+        struct promise_type
+        {
+            HeapTask get_return_object() { return HeapTask{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+            std::suspend_always initial_suspend() { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() { }
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        explicit HeapTask(std::coroutine_handle<promise_type> coro_handle)
+            : coro_handle_{coro_handle}
+        { }
+
+        HeapTask(HeapTask&& other)
+            : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+        { }
+
+        ~HeapTask()
+        {
+            if (coro_handle_)
+                coro_handle_.destroy();
+        }
+
+        void resume() { coro_handle_.resume(); }
+
+    private:
+        std::coroutine_handle<promise_type> coro_handle_;
+    };
+
+    HeapTask heap_coro(int& counter)
+    {
+        ++counter;
+        co_return;
+    }
+
+    Task<> pooled_coro(int& counter)
+    {
+        ++counter;
+        co_return;
+    }
+} // namespace
+
+TEST_CASE("frame pool - spawn/destroy throughput", "[.][benchmark][frame_pool]")
+{
+    constexpr int task_count = 10'000;
+    int counter = 0;
+
+    BENCHMARK("default allocator")
+    {
+        std::vector<HeapTask> tasks;
+        tasks.reserve(task_count);
+        for (int i = 0; i < task_count; ++i)
+        {
+            tasks.push_back(heap_coro(counter));
+            tasks.back().resume();
+        }
+        return counter;
+    };
+
+    BENCHMARK("frame pool")
+    {
+        std::vector<Task<>> tasks;
+        tasks.reserve(task_count);
+        for (int i = 0; i < task_count; ++i)
+        {
+            tasks.push_back(pooled_coro(counter));
+            tasks.back().get_coro_handle().resume();
+        }
+        return counter;
+    };
+
+    FramePool arena;
+
+    BENCHMARK("arena")
+    {
+        std::vector<Task<>> tasks;
+        tasks.reserve(task_count);
+        for (int i = 0; i < task_count; ++i)
+        {
+            tasks.push_back(arena_coro(std::allocator_arg, arena, counter));
+            tasks.back().get_coro_handle().resume();
+        }
+        return counter;
+    };
+}
@@ -0,0 +1,200 @@
+#ifndef FRAME_POOL_HPP
+#define FRAME_POOL_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+// the allocator_arg overloads of operator new are inlined also at -O0 - otherwise GCC reports
+// -Wmismatched-new-delete for the sized operator delete used by the coroutine frame
+#if defined(__GNUC__)
+#define FRAME_POOL_ALWAYS_INLINE [[gnu::always_inline]] inline
+#else
+#define FRAME_POOL_ALWAYS_INLINE inline
+#endif
+
+// Size-class pool for coroutine frames:
+//  - requests are rounded up to a multiple of size_class_granularity and served from per-class free lists
+//  - frames bigger than max_pooled_size (or allocated when a free list is empty) go to the global heap (miss)
+//  - a FramePool is not thread safe - every thread has its own default pool (FramePool::local()),
+//    an explicit arena must be used by a single thread (e.g. owned by a single-threaded Scheduler)
+class FramePool
+{
+public:
+    static constexpr std::size_t size_class_granularity = 64;
+    static constexpr std::size_t size_class_count = 16;
+    static constexpr std::size_t max_pooled_size = size_class_granularity * size_class_count;
+    static constexpr std::size_t max_cached_blocks_per_class = 4096;
+
+    struct Stats
+    {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t cached_blocks = 0;
+    };
+
+    FramePool() = default;
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    ~FramePool()
+    {
+        for (std::size_t size_class = 0; size_class < size_class_count; ++size_class)
+        {
+            while (FreeBlock* block = free_lists_[size_class].head)
+            {
+                free_lists_[size_class].head = block->next;
+                ::operator delete(block, block_size(size_class));
+            }
+        }
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size)
+    {
+        if (size > max_pooled_size)
+        {
+            ++stats_.misses;
+            return ::operator new(size);
+        }
+
+        const std::size_t size_class = size_class_of(size);
+        FreeList& free_list = free_lists_[size_class];
+
+        if (FreeBlock* block = free_list.head)
+        {
+            free_list.head = block->next;
+            --free_list.count;
+            --stats_.cached_blocks;
+            ++stats_.hits;
+            return block;
+        }
+
+        ++stats_.misses;
+        return ::operator new(block_size(size_class));
+    }
+
+    void deallocate(void* ptr, std::size_t size) noexcept
+    {
+        if (size > max_pooled_size)
+        {
+            ::operator delete(ptr, size);
+            return;
+        }
+
+        const std::size_t size_class = size_class_of(size);
+        FreeList& free_list = free_lists_[size_class];
+
+        if (free_list.count == max_cached_blocks_per_class)
+        {
+            ::operator delete(ptr, block_size(size_class));
+            return;
+        }
+
+        free_list.head = ::new (ptr) FreeBlock{free_list.head};
+        ++free_list.count;
+        ++stats_.cached_blocks;
+    }
+
+    Stats stats() const
+    {
+        return stats_;
+    }
+
+    void reset_stats()
+    {
+        stats_.hits = stats_.misses = 0;
+    }
+
+    // default pool of the calling thread
+    static FramePool& local()
+    {
+        thread_local FramePool pool;
+        return pool;
+    }
+
+    // Coroutine frame = [FrameHeader][frame]; the header remembers the arena the frame came from
+    // (nullptr - pool of the thread that releases the frame, so frames may be destroyed on any thread)
+    static void* allocate_frame(std::size_t frame_size, FramePool* arena)
+    {
+        FramePool& pool = arena ? *arena : local();
+        void* block = pool.allocate(frame_size + sizeof(FrameHeader));
+        ::new (block) FrameHeader{arena, frame_size};
+        return static_cast<std::byte*>(block) + sizeof(FrameHeader);
+    }
+
+    // size requested by the compiler for a frame returned by allocate_frame()
+    static std::size_t frame_size(const void* frame) noexcept
+    {
+        return reinterpret_cast<const FrameHeader*>(static_cast<const std::byte*>(frame) - sizeof(FrameHeader))->frame_size;
+    }
+
+    static void deallocate_frame(void* frame, std::size_t frame_size) noexcept
+    {
+        void* block = static_cast<std::byte*>(frame) - sizeof(FrameHeader);
+        FramePool* arena = static_cast<FrameHeader*>(block)->arena;
+        FramePool& pool = arena ? *arena : local();
+        pool.deallocate(block, frame_size + sizeof(FrameHeader));
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* head = nullptr;
+        std::size_t count = 0;
+    };
+
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameHeader
+    {
+        FramePool* arena;
+        std::size_t frame_size;
+    };
+
+    std::array<FreeList, size_class_count> free_lists_{};
+    Stats stats_{};
+
+    static constexpr std::size_t size_class_of(std::size_t size)
+    {
+        return size == 0 ? 0 : (size - 1) / size_class_granularity;
+    }
+
+    static constexpr std::size_t block_size(std::size_t size_class)
+    {
+        return (size_class + 1) * size_class_granularity;
+    }
+};
+
+// Mixin for promise types - coroutine frames are allocated from FramePool::local() or,
+// when the coroutine takes (std::allocator_arg_t, FramePool&, ...) as leading parameters, from the given arena
+struct PooledFrameAllocation
+{
+    static void* operator new(std::size_t frame_size)
+    {
+        return FramePool::allocate_frame(frame_size, nullptr);
+    }
+
+    template <typename... TArgs>
+    FRAME_POOL_ALWAYS_INLINE static void* operator new(std::size_t frame_size, std::allocator_arg_t, FramePool& arena, TArgs&...)
+    {
+        return FramePool::allocate_frame(frame_size, &arena);
+    }
+
+    // member coroutines - the object parameter comes first
+    template <typename TObject, typename... TArgs>
+    FRAME_POOL_ALWAYS_INLINE static void* operator new(std::size_t frame_size, TObject&, std::allocator_arg_t, FramePool& arena, TArgs&...)
+    {
+        return FramePool::allocate_frame(frame_size, &arena);
+    }
+
+    static void operator delete(void* frame, std::size_t frame_size) noexcept
+    {
+        FramePool::deallocate_frame(frame, frame_size);
+    }
+};
+
+#endif
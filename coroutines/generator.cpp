@@ -0,0 +1,253 @@
+#include "frame_pool.hpp"
+#include "generator.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+static_assert(std::ranges::input_range<Generator<int>>);
+static_assert(std::ranges::view<Generator<int>>);
+static_assert(std::same_as<std::ranges::range_reference_t<Generator<int>>, const int&>);
+static_assert(std::same_as<std::ranges::range_reference_t<Generator<std::string&>>, std::string&>);
+
+namespace
+{
+    Generator<int> iota(int start)
+    {
+        for (int i = start;; ++i)
+            co_yield i;
+    }
+
+    Generator<std::string_view> tokens(std::string_view text, char separator)
+    {
+        while (!text.empty())
+        {
+            auto pos = text.find(separator);
+            co_yield text.substr(0, pos);
+            text = (pos == std::string_view::npos) ? std::string_view{} : text.substr(pos + 1);
+        }
+    }
+
+    struct CopyCounter
+    {
+        inline static int copies = 0;
+
+        int value;
+
+        CopyCounter(int v)
+            : value{v}
+        { }
+
+        CopyCounter(const CopyCounter& other)
+            : value{other.value}
+        {
+            ++copies;
+        }
+    };
+
+    Generator<const CopyCounter&> items_of(const std::vector<CopyCounter>& items)
+    {
+        for (const auto& item : items)
+            co_yield item;
+    }
+
+    Generator<std::string&> mutable_items(std::vector<std::string>& items)
+    {
+        for (auto& item : items)
+            co_yield item;
+    }
+
+    struct Node
+    {
+        int value;
+        std::vector<Node> children;
+    };
+
+    Generator<int> depth_first(const Node& node)
+    {
+        co_yield node.value;
+        for (const auto& child : node.children)
+            co_yield elements_of(depth_first(child));
+    }
+
+    Generator<int> throwing_after(int count)
+    {
+        for (int i = 0; i < count; ++i)
+            co_yield i;
+        throw std::runtime_error{"generator failed"};
+    }
+
+    Generator<int> nested_throwing()
+    {
+        co_yield -1;
+        co_yield elements_of(throwing_after(2));
+    }
+} // namespace
+
+TEST_CASE("Generator - lazy sequence", "[coroutines][generator]")
+{
+    std::vector<int> result;
+    for (int i : iota(1))
+    {
+        if (i > 5)
+            break;
+        result.push_back(i);
+    }
+
+    CHECK(result == std::vector{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("Generator - views pipelines", "[coroutines][generator]")
+{
+    auto squares_of_evens = iota(1)
+        | std::views::filter([](int x) { return x % 2 == 0; })
+        | std::views::transform([](int x) { return x * x; })
+        | std::views::take(4);
+
+    std::vector<int> result;
+    std::ranges::copy(squares_of_evens, std::back_inserter(result));
+    CHECK(result == std::vector{4, 16, 36, 64});
+
+    auto words = tokens("one,two,,three", ',') | std::views::filter([](std::string_view token) { return !token.empty(); });
+    std::vector<std::string_view> result_words;
+    std::ranges::copy(words, std::back_inserter(result_words));
+    CHECK(result_words == std::vector{"one"sv, "two"sv, "three"sv});
+}
+
+TEST_CASE("Generator - references are yielded without copies", "[coroutines][generator]")
+{
+    std::vector<CopyCounter> items{1, 2, 3};
+    CopyCounter::copies = 0;
+
+    int sum = 0;
+    for (const CopyCounter& item : items_of(items))
+        sum += item.value;
+
+    CHECK(sum == 6);
+    CHECK(CopyCounter::copies == 0);
+
+    std::vector<std::string> words = {"a", "b"};
+    for (std::string& word : mutable_items(words))
+        word += "!";
+    CHECK(words == std::vector{"a!"s, "b!"s});
+}
+
+TEST_CASE("Generator - recursive yielding of nested generators", "[coroutines][generator]")
+{
+    Node tree{1, {{2, {{3, {}}, {4, {}}}}, {5, {{6, {{7, {}}}}}}}};
+
+    std::vector<int> result;
+    std::ranges::copy(depth_first(tree), std::back_inserter(result));
+
+    CHECK(result == std::vector{1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST_CASE("Generator - exceptions", "[coroutines][generator]")
+{
+    std::vector<int> result;
+
+    SECTION("thrown from the generator are rethrown by the iterator")
+    {
+        auto consume = [&] {
+            for (int i : throwing_after(3))
+                result.push_back(i);
+        };
+        CHECK_THROWS_AS(consume(), std::runtime_error);
+        CHECK(result == std::vector{0, 1, 2});
+    }
+
+    SECTION("thrown from a nested generator are propagated through the parent")
+    {
+        auto consume = [&] {
+            for (int i : nested_throwing())
+                result.push_back(i);
+        };
+        CHECK_THROWS_AS(consume(), std::runtime_error);
+        CHECK(result == std::vector{-1, 0, 1});
+    }
+}
+
+TEST_CASE("Generator - frames are reused", "[coroutines][generator]")
+{
+    for (int i : iota(0) | std::views::take(1)) // warm up the pool
+        (void)i;
+    FramePool::local().reset_stats();
+
+    for (int round = 0; round < 10; ++round)
+    {
+        for (int i : iota(0) | std::views::take(3))
+            (void)i;
+    }
+
+    CHECK(FramePool::local().stats().hits == 10);
+    CHECK(FramePool::local().stats().misses == 0);
+}
+
+namespace
+{
+    // hand-written equivalent of the iota generator
+    class IotaRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            using value_type = int;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            explicit iterator(int value) : value_{value} { }
+
+            const int& operator*() const { return value_; }
+            iterator& operator++() { ++value_; return *this; }
+            void operator++(int) { ++value_; }
+            friend bool operator==(const iterator&, std::default_sentinel_t) { return false; }
+
+        private:
+            int value_ = 0;
+        };
+
+        explicit IotaRange(int start) : start_{start} { }
+
+        iterator begin() const { return iterator{start_}; }
+        std::default_sentinel_t end() const { return {}; }
+
+    private:
+        int start_;
+    };
+
+    template <typename TRange>
+    long sum_of_filtered(TRange&& rng, int count)
+    {
+        long sum = 0;
+        for (int x : std::forward<TRange>(rng) | std::views::filter([](int x) { return x % 3 != 0; }) | std::views::take(count))
+            sum += x;
+        return sum;
+    }
+} // namespace
+
+TEST_CASE("Generator vs hand-written iterator", "[.][benchmark][generator]")
+{
+    constexpr int count = 1'000'000;
+
+    CHECK(sum_of_filtered(iota(0), count) == sum_of_filtered(IotaRange{0}, count));
+
+    BENCHMARK("hand-written iterator")
+    {
+        return sum_of_filtered(IotaRange{0}, count);
+    };
+
+    BENCHMARK("Generator")
+    {
+        return sum_of_filtered(iota(0), count);
+    };
+}
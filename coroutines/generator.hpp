@@ -0,0 +1,222 @@
+#ifndef GENERATOR_HPP
+#define GENERATOR_HPP
+
+#include "frame_pool.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+class Generator;
+
+// co_yield elements_of(nested_generator) - yields all elements of the nested generator
+template <typename TGenerator>
+struct ElementsOf
+{
+    TGenerator generator;
+};
+
+template <typename T>
+ElementsOf<Generator<T>> elements_of(Generator<T>&& generator)
+{
+    return {std::move(generator)};
+}
+
+// Lazy sequence produced by a coroutine - models std::ranges::input_range (and view),
+// so it can be piped into std::views adaptors
+//  - Generator<T> yields const T& (Generator<T&> yields T&) - co_yield stores only a pointer to the yielded object
+//  - nested generators are resumed directly (co_yield elements_of(gen)), without re-yielding every element
+//  - frames come from the FramePool (PooledFrameAllocation)
+template <typename T>
+class Generator : public std::ranges::view_interface<Generator<T>>
+{
+public:
+    using value_type = std::remove_cvref_t<T>;
+    using reference = std::conditional_t<std::is_reference_v<T>, T, const T&>;
+    using pointer = std::add_pointer_t<reference>;
+
+    class promise_type : public PooledFrameAllocation
+    {
+    public:
+        Generator get_return_object()
+        {
+            return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter
+        {
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> coro_handle) noexcept
+            {
+                promise_type& promise = coro_handle.promise();
+
+                if (promise.parent_)
+                {
+                    promise.root_->leaf_ = promise.parent_; // nested generator exhausted - continue with the parent
+                    return promise.parent_;
+                }
+
+                return std::noop_coroutine();
+            }
+
+            void await_resume() noexcept { }
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(reference value) noexcept
+        {
+            root_->value_ = std::addressof(value);
+            return {};
+        }
+
+        auto yield_value(ElementsOf<Generator> nested) noexcept
+        {
+            struct NestedAwaiter
+            {
+                Generator generator;
+
+                bool await_ready() noexcept { return !generator.coro_handle_; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> coro_handle) noexcept
+                {
+                    promise_type& parent = coro_handle.promise();
+                    promise_type& nested = generator.coro_handle_.promise();
+
+                    nested.root_ = parent.root_;
+                    nested.parent_ = coro_handle;
+                    parent.root_->leaf_ = generator.coro_handle_;
+
+                    return generator.coro_handle_;
+                }
+
+                void await_resume()
+                {
+                    if (auto exception = generator.coro_handle_.promise().exception_)
+                        std::rethrow_exception(exception);
+                }
+            };
+
+            return NestedAwaiter{std::move(nested.generator)};
+        }
+
+        template <typename TAwaitable>
+        void await_transform(TAwaitable&&) = delete; // generators are synchronous - co_await is not allowed
+
+        void return_void() noexcept { }
+
+        void unhandled_exception()
+        {
+            if (!parent_)
+                throw; // rethrown from begin() or operator++ of the iterator
+
+            exception_ = std::current_exception(); // rethrown in the parent generator
+        }
+
+    private:
+        friend class Generator;
+
+        promise_type* root_ = this;
+        std::coroutine_handle<promise_type> parent_ = nullptr;
+        std::coroutine_handle<promise_type> leaf_ = std::coroutine_handle<promise_type>::from_promise(*this); // root only
+        pointer value_ = nullptr;                                                                            // root only
+        std::exception_ptr exception_;
+
+        void resume_leaf()
+        {
+            leaf_.resume();
+        }
+    };
+
+    class iterator
+    {
+    public:
+        using value_type = Generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        reference operator*() const
+        {
+            return static_cast<reference>(*coro_handle_.promise().value_);
+        }
+
+        iterator& operator++()
+        {
+            coro_handle_.promise().resume_leaf();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t)
+        {
+            return it.coro_handle_.done();
+        }
+
+    private:
+        friend class Generator;
+
+        std::coroutine_handle<promise_type> coro_handle_ = nullptr;
+
+        explicit iterator(std::coroutine_handle<promise_type> coro_handle)
+            : coro_handle_{coro_handle}
+        { }
+    };
+
+    Generator() = default;
+
+    Generator(Generator&& other) noexcept
+        : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+    { }
+
+    Generator& operator=(Generator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (coro_handle_)
+                coro_handle_.destroy();
+            coro_handle_ = std::exchange(other.coro_handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Generator()
+    {
+        if (coro_handle_)
+            coro_handle_.destroy();
+    }
+
+    // single pass - may be called only once
+    iterator begin()
+    {
+        coro_handle_.promise().resume_leaf();
+        return iterator{coro_handle_};
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_handle_ = nullptr;
+
+    explicit Generator(std::coroutine_handle<promise_type> coro_handle)
+        : coro_handle_{coro_handle}
+    { }
+};
+
+#endif
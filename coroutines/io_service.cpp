@@ -0,0 +1,157 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    class TempFile
+    {
+    public:
+        TempFile()
+        {
+            std::string path_template = (std::filesystem::temp_directory_path() / "coroutines-io-XXXXXX").string();
+            fd_ = mkstemp(path_template.data());
+            REQUIRE(fd_ >= 0);
+            path_ = path_template;
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            close(fd_);
+            std::filesystem::remove(path_);
+        }
+
+        int fd() const { return fd_; }
+
+    private:
+        int fd_;
+        std::filesystem::path path_;
+    };
+
+    Task<std::string> write_and_read_back(Scheduler& scheduler, int fd, std::string_view text, off_t offset)
+    {
+        std::size_t written = co_await scheduler.write(fd, std::as_bytes(std::span{text}), offset);
+        REQUIRE(written == text.size());
+
+        std::string buffer(text.size(), '\0');
+        std::size_t read = co_await scheduler.read(fd, std::as_writable_bytes(std::span{buffer}), offset);
+        buffer.resize(read);
+
+        co_return buffer;
+    }
+
+    Task<> read_from_invalid_fd(Scheduler& scheduler, std::error_code& error)
+    {
+        std::array<std::byte, 16> buffer;
+        try
+        {
+            co_await scheduler.read(-1, buffer, 0);
+        }
+        catch (const std::system_error& e)
+        {
+            error = e.code();
+        }
+    }
+
+    Task<std::size_t> read_into(Scheduler& scheduler, int fd, std::span<std::byte> buffer)
+    {
+        co_return co_await scheduler.read(fd, buffer, 0);
+    }
+
+    // a buffer longer than 4 GiB (reserved, not backed by memory) - the read is not truncated to the low 32 bits of its size
+    void check_huge_buffer(IoBackend backend)
+    {
+        constexpr std::size_t huge_size = (std::size_t{1} << 32) + 16;
+        void* memory = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (memory == MAP_FAILED)
+            SKIP("cannot reserve 4 GiB of address space");
+
+        Scheduler scheduler{backend};
+        TempFile file;
+        const std::string content(64, 'x');
+        REQUIRE(pwrite(file.fd(), content.data(), content.size(), 0) == static_cast<ssize_t>(content.size()));
+
+        Task<std::size_t> task = read_into(scheduler, file.fd(), std::span{static_cast<std::byte*>(memory), huge_size});
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == content.size()); // the whole file - not 16 bytes
+        munmap(memory, huge_size);
+    }
+
+    void check_file_io(IoBackend backend)
+    {
+        Scheduler scheduler{backend};
+        TempFile file;
+
+        constexpr int record_count = 64;
+        constexpr std::size_t record_size = 32;
+
+        std::vector<std::string> records;
+        std::vector<Task<std::string>> tasks;
+        for (int i = 0; i < record_count; ++i)
+        {
+            std::string record = "record #" + std::to_string(i);
+            record.resize(record_size, '.');
+            records.push_back(record);
+        }
+
+        for (int i = 0; i < record_count; ++i) // all writes are submitted in a single batch
+        {
+            tasks.push_back(write_and_read_back(scheduler, file.fd(), records[i], i * record_size));
+            scheduler.submit_task(tasks.back());
+        }
+
+        scheduler.run();
+
+        for (int i = 0; i < record_count; ++i)
+            CHECK(tasks[i].result() == records[i]);
+
+        std::string content(record_count * record_size, '\0');
+        CHECK(pread(file.fd(), content.data(), content.size(), 0) == static_cast<ssize_t>(content.size()));
+        CHECK(content.substr(5 * record_size, record_size) == records[5]);
+
+        std::error_code error;
+        Task<> failing = read_from_invalid_fd(scheduler, error);
+        scheduler.submit_task(failing);
+        scheduler.run();
+        CHECK(error == std::errc::bad_file_descriptor);
+    }
+} // namespace
+
+TEST_CASE("scheduler file I/O - io_uring", "[coroutines][io]")
+{
+    Scheduler probe;
+    if (probe.io_backend() != IoBackend::io_uring)
+        SKIP("io_uring is not available");
+
+    check_file_io(IoBackend::io_uring);
+    check_huge_buffer(IoBackend::io_uring);
+}
+
+TEST_CASE("scheduler file I/O - thread pool fallback", "[coroutines][io]")
+{
+    Scheduler scheduler{IoBackend::thread_pool};
+    CHECK(scheduler.io_backend() == IoBackend::thread_pool);
+
+    check_file_io(IoBackend::thread_pool);
+    check_huge_buffer(IoBackend::thread_pool);
+}
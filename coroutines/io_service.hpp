@@ -0,0 +1,275 @@
+#ifndef IO_SERVICE_HPP
+#define IO_SERVICE_HPP
+
+#include "io_uring.hpp"
+
+#include <thread_pool.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <system_error>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if HAS_IO_URING
+#include <poll.h>
+#include <sys/eventfd.h>
+#endif
+
+enum class IoBackend
+{
+    automatic, // io_uring if the kernel supports it, thread pool otherwise
+    io_uring,
+    thread_pool
+};
+
+class IoService;
+
+// File read/write request - lives in the awaiter (i.e. in the coroutine frame) until the coroutine is resumed
+struct IoOperation : helpers::WorkItem
+{
+    enum class Kind
+    {
+        read,
+        write
+    };
+
+    Kind kind;
+    int fd;
+    std::byte* buffer;
+    std::size_t size;
+    off_t offset;
+
+    std::coroutine_handle<> coro_handle = nullptr;
+    long result = 0; // bytes transferred or -errno
+    IoService* service = nullptr;
+};
+
+// I/O backend of a Scheduler:
+//  - io_uring: start() only fills a submission entry, submit() passes the whole batch to the kernel
+//    with a single system call, reap() hands completed operations back to the scheduler
+//  - thread pool (io_uring not available): blocking pread/pwrite executed by a small pool of threads
+class IoService
+{
+public:
+    using CompletionHandler = void (*)(void* context, IoOperation& operation);
+
+    IoService(IoBackend backend, CompletionHandler on_completed, void* context,
+        unsigned queue_depth = 256, std::size_t pool_size = 2)
+        : on_completed_{on_completed}
+        , context_{context}
+    {
+#if HAS_IO_URING
+        if (backend != IoBackend::thread_pool)
+        {
+            try
+            {
+                ring_.emplace(queue_depth);
+                wake_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+                if (wake_fd_ < 0) // without it a blocked run() could not be woken up by other threads
+                    throw std::system_error{errno, std::system_category(), "eventfd"};
+                backend_ = IoBackend::io_uring;
+                return;
+            }
+            catch (const std::system_error&)
+            {
+                ring_.reset();
+                if (backend == IoBackend::io_uring)
+                    throw;
+            }
+        }
+#else
+        (void)queue_depth;
+        if (backend == IoBackend::io_uring)
+            throw std::system_error{ENOSYS, std::system_category(), "io_uring is not supported"};
+#endif
+
+        pool_.emplace(pool_size);
+        backend_ = IoBackend::thread_pool;
+    }
+
+    IoService(const IoService&) = delete;
+    IoService& operator=(const IoService&) = delete;
+
+    ~IoService()
+    {
+#if HAS_IO_URING
+        if (wake_fd_ >= 0)
+            close(wake_fd_);
+#endif
+    }
+
+    IoBackend backend() const
+    {
+        return backend_;
+    }
+
+    // must be called on the scheduler thread
+    void start(IoOperation& operation)
+    {
+#if HAS_IO_URING
+        if (ring_)
+        {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = (operation.kind == IoOperation::Kind::read) ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe->fd = operation.fd;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(operation.buffer);
+            // longer buffers end in a short read/write (like pread/pwrite) instead of a truncated length
+            sqe->len = static_cast<unsigned>(std::min<std::size_t>(operation.size, std::numeric_limits<unsigned>::max()));
+            sqe->off = static_cast<std::uint64_t>(operation.offset);
+            sqe->user_data = reinterpret_cast<std::uintptr_t>(&operation);
+
+            ++in_flight_;
+            return;
+        }
+#endif
+        operation.execute = &IoService::execute_blocking;
+        operation.service = this;
+        pool_->submit(operation);
+    }
+
+    // passes all operations started since the previous call to the kernel (one system call)
+    void submit()
+    {
+#if HAS_IO_URING
+        if (ring_ && ring_->unsubmitted() > 0)
+            ring_->submit();
+#endif
+    }
+
+    // resumes (via the completion handler) coroutines whose operations have completed
+    void reap()
+    {
+#if HAS_IO_URING
+        if (!ring_)
+            return;
+
+        ring_->for_each_completion([this](const io_uring_cqe& cqe) {
+            if (cqe.user_data == timeout_tag)
+                return;
+
+            if (cqe.user_data == wake_tag)
+            {
+                wake_armed_ = false;
+                eventfd_t value;
+                eventfd_read(wake_fd_, &value);
+                return;
+            }
+
+            auto* operation = reinterpret_cast<IoOperation*>(cqe.user_data);
+            operation->result = cqe.res;
+            --in_flight_;
+            on_completed_(context_, *operation);
+        });
+#endif
+    }
+
+    // number of io_uring operations the scheduler has to wait for (thread pool completions are pushed to the scheduler)
+    std::size_t in_flight() const
+    {
+        return in_flight_;
+    }
+
+    // blocks until at least one io_uring operation completes, wake() is called or the deadline passes
+    void wait(std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt)
+    {
+#if HAS_IO_URING
+        if (!ring_)
+            return;
+
+        if (!wake_armed_)
+        {
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->fd = wake_fd_;
+            sqe->poll32_events = POLLIN;
+            sqe->user_data = wake_tag;
+            wake_armed_ = true;
+        }
+
+        if (deadline)
+        {
+            const auto timeout = std::max(*deadline - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero());
+            const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+            timeout_ = {seconds.count(), std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds).count()};
+
+            // completes after the timeout or with the first other completion (the kernel copies timeout_ on submission)
+            io_uring_sqe* sqe = next_sqe();
+            sqe->opcode = IORING_OP_TIMEOUT;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(&timeout_);
+            sqe->len = 1;
+            sqe->off = 1;
+            sqe->user_data = timeout_tag;
+        }
+
+        ring_->submit(1);
+#else
+        (void)deadline;
+#endif
+    }
+
+    // interrupts wait() - may be called from any thread
+    void wake()
+    {
+#if HAS_IO_URING
+        if (wake_fd_ >= 0)
+            eventfd_write(wake_fd_, 1);
+#endif
+    }
+
+private:
+    CompletionHandler on_completed_;
+    void* context_;
+    IoBackend backend_ = IoBackend::thread_pool;
+    std::size_t in_flight_ = 0;
+
+#if HAS_IO_URING
+    static constexpr std::uint64_t wake_tag = 0;
+    static constexpr std::uint64_t timeout_tag = 1;
+
+    std::optional<IoUring> ring_;
+    int wake_fd_ = -1;
+    bool wake_armed_ = false;
+    __kernel_timespec timeout_{};
+
+    io_uring_sqe* next_sqe()
+    {
+        io_uring_sqe* sqe = ring_->prepare();
+        if (!sqe) // submission queue full - flush the current batch
+        {
+            ring_->submit();
+            sqe = ring_->prepare();
+        }
+        return sqe;
+    }
+#endif
+
+    std::optional<helpers::ThreadPool> pool_; // the last member - joined before anything else is destroyed
+
+    // runs on a pool thread
+    static void execute_blocking(helpers::WorkItem& item)
+    {
+        auto& operation = static_cast<IoOperation&>(item);
+
+        ssize_t result;
+        do
+        {
+            result = (operation.kind == IoOperation::Kind::read)
+                ? pread(operation.fd, operation.buffer, operation.size, operation.offset)
+                : pwrite(operation.fd, operation.buffer, operation.size, operation.offset);
+        } while (result < 0 && errno == EINTR);
+
+        operation.result = (result < 0) ? -errno : result;
+
+        IoService& service = *operation.service;
+        service.on_completed_(service.context_, operation);
+    }
+};
+
+#endif
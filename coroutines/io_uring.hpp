@@ -0,0 +1,187 @@
+#ifndef IO_URING_HPP
+#define IO_URING_HPP
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define HAS_IO_URING 1
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+// Minimal io_uring wrapper based on raw system calls (no liburing dependency):
+//  - prepare() fills submission queue entries, submit() passes all of them to the kernel in one io_uring_enter()
+//  - for_each_completion() consumes the completion queue
+class IoUring
+{
+public:
+    explicit IoUring(unsigned entries)
+    {
+        io_uring_params params{};
+
+        ring_fd_.fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (ring_fd_.fd < 0)
+            throw std::system_error{errno, std::system_category(), "io_uring_setup"};
+
+        // if a mapping fails, the members built so far unmap what is mapped and close the ring
+        std::size_t sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        std::size_t cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap)
+            sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+
+        map(sq_ring_, sq_ring_size, IORING_OFF_SQ_RING);
+        if (!single_mmap)
+            map(cq_ring_, cq_ring_size, IORING_OFF_CQ_RING);
+        map(sqes_mapping_, params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES);
+        sqes_ = static_cast<io_uring_sqe*>(sqes_mapping_.ptr);
+
+        auto* sq = static_cast<std::byte*>(sq_ring_.ptr);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_entries_ = params.sq_entries;
+
+        auto* cq = static_cast<std::byte*>(single_mmap ? sq_ring_.ptr : cq_ring_.ptr);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        local_sq_tail_ = *sq_tail_;
+    }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    // next free submission queue entry (zeroed) or nullptr when the queue is full
+    io_uring_sqe* prepare()
+    {
+        const unsigned head = std::atomic_ref{*sq_head_}.load(std::memory_order_acquire);
+        if (local_sq_tail_ - head >= sq_entries_)
+            return nullptr;
+
+        const unsigned index = local_sq_tail_ & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sq_array_[index] = index;
+        ++local_sq_tail_;
+        ++unsubmitted_;
+
+        return sqe;
+    }
+
+    unsigned unsubmitted() const
+    {
+        return unsubmitted_;
+    }
+
+    // submits all prepared entries; wait_for > 0 - blocks until so many completions are available
+    void submit(unsigned wait_for = 0)
+    {
+        std::atomic_ref{*sq_tail_}.store(local_sq_tail_, std::memory_order_release);
+
+        const unsigned to_submit = std::exchange(unsubmitted_, 0);
+        const unsigned flags = wait_for > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+        if (to_submit == 0 && wait_for == 0)
+            return;
+
+        while (syscall(__NR_io_uring_enter, ring_fd_.fd, to_submit, wait_for, flags, nullptr, 0) < 0)
+        {
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                throw std::system_error{errno, std::system_category(), "io_uring_enter"};
+        }
+    }
+
+    template <typename TCompletionHandler>
+    unsigned for_each_completion(TCompletionHandler&& handler)
+    {
+        std::atomic_ref cq_head{*cq_head_};
+        unsigned head = cq_head.load(std::memory_order_relaxed);
+        const unsigned tail = std::atomic_ref{*cq_tail_}.load(std::memory_order_acquire);
+
+        unsigned count = 0;
+        for (; head != tail; ++head, ++count)
+            handler(cqes_[head & cq_mask_]);
+
+        cq_head.store(head, std::memory_order_release);
+        return count;
+    }
+
+private:
+    struct FileDescriptor
+    {
+        int fd = -1;
+
+        FileDescriptor() = default;
+        FileDescriptor(const FileDescriptor&) = delete;
+        FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+        ~FileDescriptor()
+        {
+            if (fd >= 0)
+                close(fd);
+        }
+    };
+
+    struct Mapping
+    {
+        void* ptr = nullptr;
+        std::size_t size = 0;
+
+        Mapping() = default;
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        ~Mapping()
+        {
+            if (ptr)
+                munmap(ptr, size);
+        }
+    };
+
+    // declared before the mappings - closed after they are unmapped
+    FileDescriptor ring_fd_;
+    Mapping sq_ring_;
+    Mapping cq_ring_; // not mapped with IORING_FEAT_SINGLE_MMAP - the CQ ring is in sq_ring_
+    Mapping sqes_mapping_;
+    io_uring_sqe* sqes_ = nullptr;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    unsigned local_sq_tail_ = 0;
+    unsigned unsubmitted_ = 0;
+
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    void map(Mapping& mapping, std::size_t size, off_t offset)
+    {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_.fd, offset);
+        if (ptr == MAP_FAILED)
+            throw std::system_error{errno, std::system_category(), "io_uring mmap"};
+        mapping.ptr = ptr;
+        mapping.size = size;
+    }
+};
+
+#else
+#define HAS_IO_URING 0
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+#include "parallel_algorithms.hpp"
+#include "task.hpp"
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("parallel_for_each", "[coroutines][parallel]")
+{
+    WorkStealingScheduler scheduler{4};
+
+    SECTION("every element is visited once")
+    {
+        std::vector<int> data(100'000);
+        std::iota(data.begin(), data.end(), 0);
+
+        std::mutex mtx;
+        std::set<std::thread::id> threads;
+
+        auto task = parallel_for_each(scheduler, data, [&](int& n) {
+            if (n % 1000 == 0)
+            {
+                std::lock_guard lk{mtx};
+                threads.insert(std::this_thread::get_id());
+            }
+            n *= 2;
+        }, 1000);
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        task.result();
+        for (int i = 0; i < 100'000; ++i)
+            REQUIRE(data[i] == 2 * i);
+        CHECK(threads.size() >= 1);
+    }
+
+    SECTION("view pipeline")
+    {
+        std::vector<int> squares(1000);
+        auto indexed = std::views::iota(0, 1000) | std::views::transform([](int i) { return std::pair{i, i * i}; });
+
+        auto task = parallel_for_each(scheduler, indexed, [&](std::pair<int, int> item) { squares[item.first] = item.second; }, 64);
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(squares[999] == 999 * 999);
+        CHECK(std::ranges::all_of(std::views::iota(0, 1000), [&](int i) { return squares[i] == i * i; }));
+    }
+
+    SECTION("the first exception is rethrown")
+    {
+        std::vector<int> data(10'000, 1);
+        std::atomic<int> visited{0};
+
+        auto task = parallel_for_each(scheduler, data, [&](int n) {
+            if (++visited == 100)
+                throw std::runtime_error{"error"};
+            (void)n;
+        }, 100);
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK_THROWS_AS(task.result(), std::runtime_error);
+    }
+}
+
+TEST_CASE("parallel_transform_reduce", "[coroutines][parallel]")
+{
+    WorkStealingScheduler scheduler{4};
+
+    SECTION("sum of a transformed view")
+    {
+        auto task = parallel_transform_reduce(scheduler, std::views::iota(1LL, 1'000'001LL), 0LL, std::plus{},
+            [](long long n) { return n * 2; });
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == 1'000'000LL * 1'000'001LL);
+    }
+
+    SECTION("order of the chunks is kept")
+    {
+        std::vector<std::string> words = {"a", "b", "c", "d", "e", "f", "g"};
+
+        auto task = parallel_transform_reduce(scheduler, words, std::string{">"}, std::plus{},
+            [](const std::string& word) { return word; }, 2);
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == ">abcdefg");
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int> empty;
+
+        auto task = parallel_transform_reduce(scheduler, empty, 42, std::plus{}, std::identity{});
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == 42);
+    }
+}
+
+TEST_CASE("parallel_transform_reduce - CPU heavy loop", "[.][benchmark][parallel]")
+{
+    constexpr int size = 1'000'000;
+    auto heavy = [](int n) { return std::sqrt(static_cast<double>(n)) * std::sin(static_cast<double>(n)); };
+
+    BENCHMARK("std::transform_reduce - sequential")
+    {
+        auto values = std::views::iota(0, size);
+        return std::transform_reduce(values.begin(), values.end(), 0.0, std::plus{}, heavy);
+    };
+
+    BENCHMARK("parallel_transform_reduce - work stealing scheduler")
+    {
+        WorkStealingScheduler scheduler;
+        auto task = parallel_transform_reduce(scheduler, std::views::iota(0, size), 0.0, std::plus{}, heavy);
+        scheduler.submit_task(task);
+        scheduler.run();
+        return task.result();
+    };
+}
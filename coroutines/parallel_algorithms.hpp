@@ -0,0 +1,133 @@
+#ifndef PARALLEL_ALGORITHMS_HPP
+#define PARALLEL_ALGORITHMS_HPP
+
+#include "task.hpp"
+#include "when_all.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// scheduler on which a coroutine can move to a worker thread: co_await scheduler.schedule()
+template <typename TScheduler>
+concept ParallelScheduler = requires(TScheduler& scheduler) { scheduler.schedule(); };
+
+namespace details
+{
+    // default grain - about four chunks per worker, so idle workers have something to steal
+    template <typename TScheduler>
+    std::size_t chunk_size(const TScheduler& scheduler, std::size_t size, std::size_t grain)
+    {
+        if (grain != 0)
+            return grain;
+
+        std::size_t worker_count = std::max(1u, std::thread::hardware_concurrency());
+        if constexpr (requires { scheduler.worker_count(); })
+            worker_count = scheduler.worker_count();
+
+        return std::max<std::size_t>(1, size / (4 * worker_count));
+    }
+
+    template <typename TScheduler, typename TIterator, typename TFunction>
+    Task<> for_each_chunk(TScheduler& scheduler, TIterator first, std::iter_difference_t<TIterator> count, TFunction& f)
+    {
+        co_await scheduler.schedule();
+        const std::stop_token stop_token = co_await get_stop_token();
+        if (stop_token.stop_requested()) // a sibling chunk has failed
+            throw OperationCancelled{};
+
+        for (; count > 0; --count, ++first)
+            std::invoke(f, *first);
+    }
+
+    template <typename T, typename TScheduler, typename TIterator, typename TReduce, typename TTransform>
+    Task<T> transform_reduce_chunk(TScheduler& scheduler, TIterator first, std::iter_difference_t<TIterator> count,
+        TReduce& reduce, TTransform& transform)
+    {
+        co_await scheduler.schedule();
+        const std::stop_token stop_token = co_await get_stop_token();
+        if (stop_token.stop_requested()) // a sibling chunk has failed
+            throw OperationCancelled{};
+
+        T partial = std::invoke(transform, *first); // chunks are never empty
+        for (++first, --count; count > 0; --count, ++first)
+            partial = std::invoke(reduce, std::move(partial), std::invoke(transform, *first));
+        co_return partial;
+    }
+
+    // splits [0, size) into chunks and starts chunk(first, count) for each of them
+    template <std::ranges::random_access_range TView, typename TChunk>
+    auto make_chunks(TView& view, std::size_t chunk_size, TChunk chunk)
+    {
+        using Difference = std::ranges::range_difference_t<TView>;
+
+        const auto size = static_cast<Difference>(std::ranges::size(view));
+        const auto step = static_cast<Difference>(chunk_size);
+        const auto first = std::ranges::begin(view); // begin() of some views is not thread-safe - called only here
+
+        std::vector<decltype(chunk(first, Difference{}))> chunks;
+        chunks.reserve(static_cast<std::size_t>((size + step - 1) / step));
+        for (Difference offset = 0; offset < size; offset += step)
+            chunks.push_back(chunk(first + offset, std::min(step, size - offset)));
+        return chunks;
+    }
+
+    template <typename TScheduler, typename TView, typename TFunction>
+    Task<> parallel_for_each(TScheduler& scheduler, TView view, TFunction f, std::size_t grain)
+    {
+        auto chunks = make_chunks(view, chunk_size(scheduler, std::ranges::size(view), grain), [&](auto first, auto count) {
+            return for_each_chunk(scheduler, first, count, f);
+        });
+
+        co_await when_all(std::move(chunks));
+    }
+
+    template <typename TScheduler, typename TView, typename T, typename TReduce, typename TTransform>
+    Task<T> parallel_transform_reduce(TScheduler& scheduler, TView view, T init, TReduce reduce, TTransform transform, std::size_t grain)
+    {
+        auto chunks = make_chunks(view, chunk_size(scheduler, std::ranges::size(view), grain), [&](auto first, auto count) {
+            return transform_reduce_chunk<T>(scheduler, first, count, reduce, transform);
+        });
+
+        std::vector<T> partials = co_await when_all(std::move(chunks)); // not a range-for initializer - it would dangle
+
+        // partial results are combined in the order of the chunks - the result does not depend on the timing
+        for (T& partial : partials)
+            init = std::invoke(reduce, std::move(init), std::move(partial));
+        co_return init;
+    }
+} // namespace details
+
+// co_await parallel_for_each(scheduler, range, f, grain) - calls f for every element; chunks of grain elements
+// (0 - chosen by the number of workers) run as child tasks on the worker threads of the scheduler:
+//  - any sized random access range - containers, spans, view pipelines (iota | transform | ...)
+//  - the range (if it is not a view) must outlive the returned task
+//  - the first exception thrown by f cancels the chunks that have not started yet and is rethrown
+template <ParallelScheduler TScheduler, std::ranges::random_access_range TRange, typename TFunction>
+    requires std::ranges::sized_range<TRange> && std::ranges::viewable_range<TRange>
+          && std::invocable<TFunction&, std::ranges::range_reference_t<TRange>>
+Task<> parallel_for_each(TScheduler& scheduler, TRange&& range, TFunction f, std::size_t grain = 0)
+{
+    return details::parallel_for_each(scheduler, std::views::all(std::forward<TRange>(range)), std::move(f), grain);
+}
+
+// co_await parallel_transform_reduce(scheduler, range, init, reduce, transform, grain) - like std::transform_reduce:
+// reduce must be associative (chunks are reduced independently), the partial results are combined in order
+template <ParallelScheduler TScheduler, std::ranges::random_access_range TRange, typename T, typename TReduce, typename TTransform>
+    requires std::ranges::sized_range<TRange> && std::ranges::viewable_range<TRange>
+          && std::invocable<TTransform&, std::ranges::range_reference_t<TRange>>
+Task<T> parallel_transform_reduce(TScheduler& scheduler, TRange&& range, T init, TReduce reduce, TTransform transform, std::size_t grain = 0)
+{
+    return details::parallel_transform_reduce(scheduler, std::views::all(std::forward<TRange>(range)), std::move(init),
+        std::move(reduce), std::move(transform), grain);
+}
+
+#endif
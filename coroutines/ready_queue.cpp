@@ -0,0 +1,204 @@
+#include "ready_queue.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <coroutine>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // distinct fake handles - the queue never resumes them
+    std::vector<int> handle_storage(16);
+
+    std::coroutine_handle<> handle(int id)
+    {
+        return std::coroutine_handle<>::from_address(&handle_storage[id]);
+    }
+
+    std::vector<int> drain(ReadyQueue& queue)
+    {
+        std::vector<int> ids;
+        while (!queue.empty())
+            ids.push_back(static_cast<int>(static_cast<int*>(queue.pop().address()) - handle_storage.data()));
+        return ids;
+    }
+} // namespace
+
+TEST_CASE("ReadyQueue", "[coroutines][priority]")
+{
+    SECTION("higher bands first, FIFO within a band")
+    {
+        ReadyQueue queue{SchedulingPolicy{.starvation_limit = 0}};
+        queue.push(handle(0));
+        queue.push(handle(1), {TaskPriority::background});
+        queue.push(handle(2), {TaskPriority::critical});
+        queue.push(handle(3));
+        queue.push(handle(4), {TaskPriority::high});
+
+        CHECK(queue.size() == 5);
+        CHECK(queue.top_band() == 0);
+        CHECK(drain(queue) == std::vector{2, 4, 0, 3, 1});
+        CHECK(queue.top_band() == task_priority_count);
+    }
+
+    SECTION("earliest deadline first within a band")
+    {
+        const auto now = ReadyQueue::Clock::now();
+
+        ReadyQueue queue{SchedulingPolicy{.earliest_deadline_first = true}};
+        queue.push(handle(0));
+        queue.push(handle(1), {TaskPriority::normal, now + 30ms});
+        queue.push(handle(2), {TaskPriority::normal, now + 10ms});
+        queue.push(handle(3), {TaskPriority::normal, now + 10ms});
+        queue.push(handle(4), {TaskPriority::high, now + 50ms});
+        queue.push(handle(5));
+
+        CHECK(drain(queue) == std::vector{4, 2, 3, 1, 0, 5});
+    }
+
+    SECTION("starvation guard")
+    {
+        ReadyQueue queue{SchedulingPolicy{.starvation_limit = 2}};
+        queue.push(handle(0), {TaskPriority::low});
+        for (int id = 1; id <= 5; ++id)
+            queue.push(handle(id), {TaskPriority::critical});
+
+        CHECK(drain(queue) == std::vector{1, 2, 0, 3, 4, 5});
+    }
+
+    SECTION("splice keeps the order of submission")
+    {
+        ReadyQueue queue, incoming;
+        queue.push(handle(0), {TaskPriority::low});
+        incoming.push(handle(1), {TaskPriority::low});
+        incoming.push(handle(2), {TaskPriority::high});
+
+        queue.splice(incoming);
+
+        CHECK(incoming.empty());
+        CHECK(queue.bands() == 0b01010);
+        CHECK(drain(queue) == std::vector{2, 0, 1});
+    }
+}
+
+namespace
+{
+    Task<> log_after_fetch(Scheduler& scheduler, std::string name, std::vector<std::string>& log)
+    {
+        co_await scheduler.fetch_data();
+        log.push_back(std::move(name));
+    }
+
+    Task<> log_after_child(Scheduler& scheduler, std::string name, std::vector<std::string>& log)
+    {
+        co_await log_after_fetch(scheduler, name + "/child", log);
+        log.push_back(std::move(name));
+    }
+
+    // resumed by a coroutine of the tick, the awaiting coroutine keeps its priority
+    struct Signal
+    {
+        std::coroutine_handle<> waiter = nullptr;
+        TaskScheduling scheduling;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            waiter = awaiting_coro;
+            scheduling = scheduling_of(awaiting_coro);
+        }
+
+        void await_resume() const noexcept { }
+
+        void set(Scheduler& scheduler)
+        {
+            scheduler.submit_coro(waiter, scheduling);
+        }
+    };
+} // namespace
+
+TEST_CASE("Scheduler - priorities", "[coroutines][priority]")
+{
+    std::vector<std::string> log;
+
+    SECTION("ready tasks of higher bands are resumed first")
+    {
+        Scheduler scheduler;
+
+        std::vector<Task<>> tasks;
+        tasks.push_back(log_after_fetch(scheduler, "background", log));
+        tasks.push_back(log_after_fetch(scheduler, "normal", log));
+        tasks.push_back(log_after_fetch(scheduler, "critical", log));
+        scheduler.submit_task(tasks[0], TaskPriority::background);
+        scheduler.submit_task(tasks[1]);
+        scheduler.submit_task(tasks[2], TaskPriority::critical);
+        scheduler.run();
+
+        CHECK(log == std::vector<std::string>{"critical", "normal", "background"});
+    }
+
+    SECTION("priority is inherited by awaited tasks")
+    {
+        Scheduler scheduler;
+
+        auto low = log_after_child(scheduler, "low", log);
+        auto high = log_after_child(scheduler, "high", log);
+        scheduler.submit_task(low, TaskPriority::low);
+        scheduler.submit_task(high, TaskPriority::high);
+        scheduler.run();
+
+        CHECK(log == std::vector<std::string>{"high/child", "high", "low/child", "low"});
+    }
+
+    SECTION("a task of a higher band ready during a tick overtakes the rest of the tick")
+    {
+        Scheduler scheduler;
+        Signal signal;
+
+        auto critical = [](Signal& signal, std::vector<std::string>& log) -> Task<> {
+            co_await signal;
+            log.push_back("critical");
+        }(signal, log);
+
+        auto first = [](Scheduler& scheduler, Signal& signal, std::vector<std::string>& log) -> Task<> {
+            log.push_back("first");
+            signal.set(scheduler);
+            co_return;
+        }(scheduler, signal, log);
+
+        auto second = [](std::vector<std::string>& log) -> Task<> {
+            log.push_back("second");
+            co_return;
+        }(log);
+
+        scheduler.submit_task(critical, TaskPriority::critical);
+        scheduler.submit_task(first);
+        scheduler.submit_task(second);
+        scheduler.run();
+
+        CHECK(log == std::vector<std::string>{"first", "critical", "second"});
+    }
+
+    SECTION("earliest deadline first")
+    {
+        Scheduler scheduler{IoBackend::automatic, {}, SchedulingPolicy{.earliest_deadline_first = true}};
+        const auto now = Scheduler::Clock::now();
+
+        auto late = log_after_fetch(scheduler, "late", log);
+        auto none = log_after_fetch(scheduler, "no deadline", log);
+        auto early = log_after_fetch(scheduler, "early", log);
+        scheduler.submit_task(late, TaskScheduling{TaskPriority::normal, now + 100ms});
+        scheduler.submit_task(none);
+        scheduler.submit_task(early, TaskScheduling{TaskPriority::normal, now + 10ms});
+        scheduler.run();
+
+        CHECK(log == std::vector<std::string>{"early", "late", "no deadline"});
+    }
+}
@@ -0,0 +1,170 @@
+#ifndef READY_QUEUE_HPP
+#define READY_QUEUE_HPP
+
+#include "task.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// Order in which a scheduler resumes ready coroutines
+struct SchedulingPolicy
+{
+    bool earliest_deadline_first = false; // within a priority band - coroutines without a deadline go last
+    std::size_t starvation_limit = 64; // a waiting band is served after this many resumptions from higher bands
+                                       // (zero - strict priorities)
+};
+
+// Run queue with one band per TaskPriority:
+//  - push()/pop() are O(1) (plus O(log n) in earliest-deadline-first mode):
+//    a bitmask of non-empty bands - the highest one is found with countr_zero
+//  - a band is a FIFO, or a binary heap ordered by (deadline, submission order) in earliest-deadline-first mode
+//  - starvation guard - a non-empty band passed over starvation_limit times in a row is served next
+class ReadyQueue
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ReadyQueue(SchedulingPolicy policy = {})
+        : policy_{policy}
+    { }
+
+    bool empty() const
+    {
+        return occupied_ == 0;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    // bit b set - band b is not empty
+    std::uint32_t bands() const
+    {
+        return occupied_;
+    }
+
+    // highest non-empty band (task_priority_count when empty)
+    std::size_t top_band() const
+    {
+        return empty() ? task_priority_count : static_cast<std::size_t>(std::countr_zero(occupied_));
+    }
+
+    void push(std::coroutine_handle<> coro_handle, TaskScheduling scheduling = {})
+    {
+        const auto band = static_cast<std::size_t>(scheduling.priority);
+        push(band, Entry{coro_handle, scheduling.deadline, next_sequence_++});
+    }
+
+    // precondition: !empty()
+    std::coroutine_handle<> pop()
+    {
+        const std::size_t band = select_band();
+        std::deque<Entry>& entries = bands_[band];
+
+        Entry entry;
+        if (policy_.earliest_deadline_first)
+        {
+            std::ranges::pop_heap(entries, std::greater{});
+            entry = entries.back();
+            entries.pop_back();
+        }
+        else
+        {
+            entry = entries.front();
+            entries.pop_front();
+        }
+
+        if (entries.empty())
+            occupied_ &= ~(1u << band);
+        --size_;
+
+        return entry.coro_handle;
+    }
+
+    // moves all entries of other into this queue (other keeps its starvation counters)
+    void splice(ReadyQueue& other)
+    {
+        for (std::size_t band = 0; band < task_priority_count; ++band)
+        {
+            for (const Entry& entry : other.bands_[band])
+                push(band, entry);
+            other.bands_[band].clear();
+        }
+        other.occupied_ = 0;
+        other.size_ = 0;
+    }
+
+private:
+    struct Entry
+    {
+        std::coroutine_handle<> coro_handle;
+        Clock::time_point deadline;
+        std::uint64_t sequence;
+
+        bool operator>(const Entry& other) const
+        {
+            return deadline != other.deadline ? deadline > other.deadline : sequence > other.sequence;
+        }
+    };
+
+    SchedulingPolicy policy_;
+    std::array<std::deque<Entry>, task_priority_count> bands_;
+    std::array<std::size_t, task_priority_count> passed_over_{};
+    std::uint32_t occupied_ = 0;
+    std::size_t size_ = 0;
+    std::uint64_t next_sequence_ = 0;
+
+    void push(std::size_t band, const Entry& entry)
+    {
+        std::deque<Entry>& entries = bands_[band];
+        entries.push_back(entry);
+        if (policy_.earliest_deadline_first)
+            std::ranges::push_heap(entries, std::greater{});
+
+        if (entries.size() == 1)
+        {
+            occupied_ |= 1u << band;
+            passed_over_[band] = 0;
+        }
+        ++size_;
+    }
+
+    // the highest band - unless a lower one has been waiting for too long
+    std::size_t select_band()
+    {
+        std::size_t selected = static_cast<std::size_t>(std::countr_zero(occupied_));
+
+        if (policy_.starvation_limit != 0)
+        {
+            for (std::uint32_t waiting = occupied_ & (occupied_ - 1); waiting != 0; waiting &= waiting - 1)
+            {
+                const auto band = static_cast<std::size_t>(std::countr_zero(waiting));
+                if (passed_over_[band] >= policy_.starvation_limit)
+                {
+                    selected = band;
+                    break;
+                }
+            }
+
+            for (std::uint32_t waiting = occupied_; waiting != 0; waiting &= waiting - 1)
+            {
+                const auto band = static_cast<std::size_t>(std::countr_zero(waiting));
+                if (band > selected)
+                    ++passed_over_[band];
+            }
+            passed_over_[selected] = 0;
+        }
+
+        return selected;
+    }
+};
+
+#endif
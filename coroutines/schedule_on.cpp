@@ -0,0 +1,126 @@
+#include "schedule_on.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <thread_pool.hpp>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Threads
+    {
+        std::thread::id before;
+        std::thread::id offloaded;
+        std::thread::id after;
+    };
+
+    Task<int> offloaded_sum(Scheduler& scheduler, helpers::ThreadPool& pool, Threads& threads)
+    {
+        threads.before = std::this_thread::get_id();
+
+        co_await schedule_on(pool);
+        threads.offloaded = std::this_thread::get_id();
+        int sum = 0;
+        for (int i = 1; i <= 100; ++i)
+            sum += i;
+
+        co_await schedule_on(scheduler);
+        threads.after = std::this_thread::get_id();
+        co_return sum;
+    }
+
+    void busy_wait(std::chrono::steady_clock::duration duration)
+    {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end)
+            ;
+    }
+
+    Task<> cpu_bound_step(Scheduler& scheduler, helpers::ThreadPool& pool, std::atomic<bool>& done)
+    {
+        co_await schedule_on(pool);
+        busy_wait(50ms);
+        co_await schedule_on(scheduler);
+        done = true;
+    }
+
+    Task<> ticker(Scheduler& scheduler, const std::atomic<bool>& done, int& ticks)
+    {
+        while (!done)
+        {
+            co_await scheduler.sleep_for(1ms);
+            ++ticks;
+        }
+    }
+
+    Task<> bounded_step(Scheduler& scheduler, helpers::ThreadPool& pool, std::atomic<int>& running, std::atomic<int>& max_running)
+    {
+        co_await schedule_on(pool);
+        int now_running = ++running;
+        int expected = max_running.load();
+        while (now_running > expected && !max_running.compare_exchange_weak(expected, now_running))
+            ;
+        busy_wait(2ms);
+        --running;
+        co_await schedule_on(scheduler);
+    }
+} // namespace
+
+TEST_CASE("schedule_on - moves a coroutine to the pool and back", "[coroutines][schedule_on]")
+{
+    Scheduler scheduler;
+    helpers::ThreadPool pool{2};
+    Threads threads;
+
+    auto task = offloaded_sum(scheduler, pool, threads);
+    scheduler.submit_task(task);
+    scheduler.run();
+
+    CHECK(task.result() == 5050);
+    CHECK(threads.before == std::this_thread::get_id());
+    CHECK(threads.offloaded != std::this_thread::get_id());
+    CHECK(threads.after == std::this_thread::get_id());
+}
+
+TEST_CASE("schedule_on - CPU-bound step does not stall the scheduler", "[coroutines][schedule_on]")
+{
+    Scheduler scheduler;
+    helpers::ThreadPool pool{1};
+    std::atomic<bool> done{false};
+    int ticks = 0;
+
+    auto heavy = cpu_bound_step(scheduler, pool, done);
+    auto light = ticker(scheduler, done, ticks);
+    scheduler.submit_task(heavy);
+    scheduler.submit_task(light);
+    scheduler.run();
+
+    heavy.result();
+    CHECK(ticks >= 10); // timers kept firing during the 50ms step
+}
+
+TEST_CASE("schedule_on - the pool bounds the parallelism", "[coroutines][schedule_on]")
+{
+    Scheduler scheduler;
+    helpers::ThreadPool pool{2};
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+
+    std::vector<Task<>> tasks;
+    for (int i = 0; i < 8; ++i)
+        tasks.push_back(bounded_step(scheduler, pool, running, max_running));
+    for (auto& task : tasks)
+        scheduler.submit_task(task);
+    scheduler.run();
+
+    for (auto& task : tasks)
+        task.result();
+    CHECK(max_running <= 2);
+}
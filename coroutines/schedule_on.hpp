@@ -0,0 +1,81 @@
+#ifndef SCHEDULE_ON_HPP
+#define SCHEDULE_ON_HPP
+
+#include "scheduler_ref.hpp"
+#include "task.hpp"
+
+#include <coroutine>
+#include <thread_pool.hpp>
+
+namespace details
+{
+    // the awaiter is the work item - it lives in the frame of the suspended coroutine
+    class ThreadPoolAwaiter : public helpers::WorkItem
+    {
+    public:
+        explicit ThreadPoolAwaiter(helpers::ThreadPool& pool) noexcept
+            : WorkItem{&ThreadPoolAwaiter::resume}
+            , pool_{&pool}
+        { }
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> coro_handle)
+        {
+            coro_handle_ = coro_handle;
+            pool_->submit(*this);
+        }
+
+        void await_resume() const noexcept { }
+
+    private:
+        helpers::ThreadPool* pool_;
+        std::coroutine_handle<> coro_handle_;
+
+        static void resume(WorkItem& self)
+        {
+            static_cast<ThreadPoolAwaiter&>(self).coro_handle_.resume();
+        }
+    };
+
+    class SchedulerAwaiter
+    {
+    public:
+        explicit SchedulerAwaiter(SchedulerRef scheduler) noexcept
+            : scheduler_{scheduler}
+        { }
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> coro_handle)
+        {
+            scheduler_.submit(coro_handle, scheduling_of(coro_handle));
+        }
+
+        void await_resume() const noexcept { }
+
+    private:
+        SchedulerRef scheduler_;
+    };
+} // namespace details
+
+// co_await schedule_on(cpu_pool) - the rest of the coroutine runs on a worker of the pool, so a CPU-bound step
+// does not stall the coroutines of the scheduler; co_await schedule_on(scheduler) moves it back:
+//   co_await schedule_on(cpu_pool);
+//   auto digest = hash(buffer);
+//   co_await schedule_on(scheduler); // priority and deadline of the task are kept
+//  - switching does not allocate - the awaiter in the coroutine frame is the queued work item
+//  - the task still counts as pending in its scheduler - it should come back before it completes
+//    (Scheduler::run() is woken only by its own ready queue)
+inline details::ThreadPoolAwaiter schedule_on(helpers::ThreadPool& pool) noexcept
+{
+    return details::ThreadPoolAwaiter{pool};
+}
+
+inline details::SchedulerAwaiter schedule_on(SchedulerRef scheduler) noexcept
+{
+    return details::SchedulerAwaiter{scheduler};
+}
+
+#endif
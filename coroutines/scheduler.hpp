@@ -0,0 +1,729 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include "frame_pool.hpp"
+#include "io_service.hpp"
+#include "ready_queue.hpp"
+#include "scheduler_trace.hpp"
+#include "task.hpp"
+#include "timer_wheel.hpp"
+#include "when_all.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <span>
+#include <stop_token>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Coalescing of fetch_data() requests - all awaiters suspended within one tick are served by one backend call
+struct FetchBatching
+{
+    std::size_t max_batch_size = 64; // a full batch is fetched immediately
+    std::chrono::steady_clock::duration max_linger{}; // how long the first request may wait for the batch to fill up
+                                                      // (zero - the batch is fetched at the end of the tick)
+};
+
+// Per-batch metrics of fetch_data() coalescing
+struct FetchBatchStats
+{
+    std::size_t batches = 0;
+    std::size_t requests = 0;
+    std::size_t largest_batch = 0;
+    std::size_t full_batches = 0; // fetched because max_batch_size was reached
+    std::chrono::steady_clock::duration total_linger{}; // sum of waiting times of the first request of each batch
+
+    double average_batch_size() const
+    {
+        return batches == 0 ? 0.0 : static_cast<double>(requests) / static_cast<double>(batches);
+    }
+};
+
+// Event-driven scheduler - only coroutines whose awaited result is available are in the ready queue:
+//  - an awaiter calls submit_coro() when its result is ready (from any thread)
+//  - run() works in ticks: a tick resumes as many coroutines as are ready at its beginning - highest priority first
+//    (SchedulingPolicy, submit_task(task, priority)), so coroutines of a higher band that become ready during the tick
+//    overtake the rest (carried over to the next tick); then it submits the file I/O started during the tick as one batch and serves all fetch_data() requests
+//    of the tick with one batched backend call
+//  - timers (sleep_for(), with_timeout()) live in a hierarchical timer wheel with 1ms ticks
+//  - when nothing is ready run() parks on a condition variable (or in io_uring when I/O is in flight)
+//    until the next timer expiry
+//  - run() returns when every submitted task has completed
+//  - sleep_for() and fetch_data() awaiters are cancelled through the stop token of the awaiting task:
+//    they are removed from the timer wheel / fetch batch right away and co_await throws OperationCancelled
+//  - with COROUTINES_TRACING run() reports per-coroutine resume statistics and run queue depth (trace_snapshot())
+class Scheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::chrono::milliseconds tick_duration{1};
+
+    explicit Scheduler(IoBackend io_backend = IoBackend::automatic, FetchBatching fetch_batching = {}, SchedulingPolicy scheduling_policy = {})
+        : ready_coroutines_{scheduling_policy}
+        , scheduling_policy_{scheduling_policy}
+        , io_{io_backend, &Scheduler::on_io_completed, this}
+        , fetch_batching_{fetch_batching}
+    {
+        fetch_batching_.max_batch_size = std::max<std::size_t>(fetch_batching_.max_batch_size, 1);
+        fetch_linger_timer_.context = this;
+        fetch_linger_timer_.on_expired = [](TimerNode& timer) { static_cast<Scheduler*>(timer.context)->fetch_batch(); };
+    }
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    void submit_coro(std::coroutine_handle<> coro_handle, TaskScheduling scheduling = {})
+    {
+        bool parked_in_io;
+        {
+            std::lock_guard lk{mtx_};
+            push_ready(coro_handle, scheduling);
+            parked_in_io = parked_in_io_;
+        }
+        cv_ready_.notify_one();
+
+        if (parked_in_io)
+            io_.wake();
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task, std::stop_token stop_token = {})
+    {
+        submit_task(task, TaskScheduling{}, std::move(stop_token));
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task, TaskPriority priority, std::stop_token stop_token = {})
+    {
+        submit_task(task, TaskScheduling{priority}, std::move(stop_token));
+    }
+
+    // priority and deadline (used by SchedulingPolicy::earliest_deadline_first) of the task
+    // and of all tasks it co_awaits
+    template <typename T>
+    void submit_task(Task<T>& task, TaskScheduling scheduling, std::stop_token stop_token = {})
+    {
+        auto coro_handle = task.get_coro_handle();
+        coro_handle.promise().pending_tasks_counter = &pending_tasks_;
+        coro_handle.promise().stop_token = std::move(stop_token);
+        coro_handle.promise().scheduling = scheduling;
+        pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+#if COROUTINES_TRACING
+        tracer_.on_task_submitted(coro_handle.address(), FramePool::frame_size(coro_handle.address()));
+#endif
+        submit_coro(coro_handle, scheduling);
+    }
+
+    // co_await scheduler.fetch_data() - the request joins the batch of the current tick
+    auto fetch_data()
+    {
+        return FetchAwaiter{*this};
+    }
+
+    // must not be called concurrently with run()
+    const FetchBatchStats& fetch_stats() const
+    {
+        return fetch_stats_;
+    }
+
+    // co_await scheduler.read(fd, buffer, offset) - number of bytes read (std::system_error on failure)
+    auto read(int fd, std::span<std::byte> buffer, off_t offset)
+    {
+        return IoAwaiter{*this, {IoOperation{{}, IoOperation::Kind::read, fd, buffer.data(), buffer.size(), offset}, {}}};
+    }
+
+    // co_await scheduler.write(fd, data, offset) - number of bytes written (std::system_error on failure)
+    auto write(int fd, std::span<const std::byte> data, off_t offset)
+    {
+        return IoAwaiter{*this,
+            {IoOperation{{}, IoOperation::Kind::write, fd, const_cast<std::byte*>(data.data()), data.size(), offset}, {}}};
+    }
+
+    // co_await scheduler.sleep_until(deadline) - resumes the coroutine once the deadline has passed
+    auto sleep_until(Clock::time_point deadline)
+    {
+        return SleepAwaiter{*this, deadline};
+    }
+
+    // co_await scheduler.sleep_for(100ms)
+    auto sleep_for(Clock::duration duration)
+    {
+        return sleep_until(Clock::now() + duration);
+    }
+
+    // arms a timer - on_expired is called by run() (on the scheduler thread) once the deadline has passed;
+    // must be called on the scheduler thread (e.g. from await_suspend())
+    void schedule_timer(TimerNode& timer, Clock::time_point deadline)
+    {
+        timers_.schedule(timer, tick_of(deadline));
+    }
+
+    void cancel_timer(TimerNode& timer)
+    {
+        timers_.cancel(timer);
+    }
+
+    std::size_t pending_timers() const
+    {
+        return timers_.size();
+    }
+
+    IoBackend io_backend() const
+    {
+        return io_.backend();
+    }
+
+    const SchedulingPolicy& scheduling_policy() const
+    {
+        return scheduling_policy_;
+    }
+
+    // scheduler whose run() executes on the calling thread (nullptr outside of run())
+    static Scheduler* current()
+    {
+        return current_;
+    }
+
+    void run()
+    {
+        Scheduler* const previous = std::exchange(current_, this);
+        ReadyQueue tick{scheduling_policy_}; // coroutines carried over from the previous tick stay here
+
+        while (true)
+        {
+            io_.submit(); // I/O started by the previous tick - a single batch
+            io_.reap();
+            timers_.advance(elapsed_ticks());
+            cancel_deferred();
+
+            {
+                std::unique_lock lk{mtx_};
+
+                const bool idle = tick.empty() && ready_coroutines_.empty();
+
+                if (idle && !deferred_cancellations_ && pending_tasks_.load(std::memory_order_acquire) != 0)
+                {
+                    wait_for_events(lk);
+                    continue;
+                }
+
+                if (idle)
+                    break;
+
+                take_ready(tick);
+            }
+
+            std::size_t budget = tick.size();
+#if COROUTINES_TRACING
+            tracer_.on_tick(budget);
+#endif
+            for (; budget > 0; --budget)
+            {
+                // a coroutine of a higher band became ready - it overtakes the rest of the tick
+                if (static_cast<std::size_t>(std::countr_zero(ready_bands_.load(std::memory_order_relaxed))) < tick.top_band())
+                {
+                    std::lock_guard lk{mtx_};
+                    take_ready(tick);
+                }
+
+                resume(tick.pop());
+            }
+#if COROUTINES_TRACING
+            tracer_.end_tick();
+#endif
+
+            if (fetch_batching_.max_linger == Clock::duration::zero())
+                fetch_batch();
+        }
+
+        current_ = previous;
+    }
+
+    // arena for frames of coroutines driven by this scheduler:
+    //   Task<> coro(std::allocator_arg_t, FramePool& arena, ...) called with (std::allocator_arg, scheduler.frame_arena(), ...)
+    // must be used only by the thread that creates and destroys these tasks
+    FramePool& frame_arena()
+    {
+        return frame_arena_;
+    }
+
+    // number of resumptions performed by run() so far
+    std::size_t resume_count() const
+    {
+        return resume_count_;
+    }
+
+#if COROUTINES_TRACING
+    // may be called from any thread, also while run() is running
+    SchedulerTraceSnapshot trace_snapshot() const
+    {
+        return tracer_.snapshot();
+    }
+#endif
+
+private:
+    // part of an awaiter that can be cancelled through the stop token of the awaiting task;
+    // copies are not connected to any stop token (awaiters stay copyable)
+    struct CancellableAwait
+    {
+        using CancelFunction = bool (*)(CancellableAwait& self); // unlinks the awaiter (false - it is not pending anymore)
+
+        struct RequestCancellation
+        {
+            CancellableAwait* self;
+
+            void operator()() const noexcept
+            {
+                self->scheduler->request_cancellation(*self);
+            }
+        };
+
+        Scheduler* scheduler;
+        CancelFunction cancel;
+        std::coroutine_handle<> coro_handle = nullptr;
+        TaskScheduling scheduling;
+        bool cancelled = false;
+        bool deferred = false; // guarded by mtx_
+        CancellableAwait* next_deferred = nullptr;
+        std::optional<std::stop_callback<RequestCancellation>> stop_callback;
+
+        CancellableAwait(Scheduler& scheduler, CancelFunction cancel)
+            : scheduler{&scheduler}
+            , cancel{cancel}
+        { }
+
+        CancellableAwait(const CancellableAwait& other)
+            : scheduler{other.scheduler}
+            , cancel{other.cancel}
+        { }
+
+        CancellableAwait& operator=(const CancellableAwait&) = delete;
+
+        // called after the awaiter has been queued
+        void watch(std::stop_token stop_token)
+        {
+            if (stop_token.stop_possible())
+                stop_callback.emplace(std::move(stop_token), RequestCancellation{this});
+        }
+
+        void finish()
+        {
+            if (stop_callback)
+            {
+                stop_callback.reset(); // waits for a callback running on another thread
+                scheduler->forget_cancellation(*this);
+            }
+
+            if (cancelled)
+                throw OperationCancelled{};
+        }
+    };
+
+    // intrusive node of the pending fetch batch
+    struct FetchAwaiter : CancellableAwait
+    {
+        FetchAwaiter* prev = nullptr;
+        FetchAwaiter* next = nullptr;
+        bool queued = false;
+        int value = 0;
+
+        explicit FetchAwaiter(Scheduler& scheduler)
+            : CancellableAwait{scheduler, &FetchAwaiter::unlink}
+        { }
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            std::stop_token stop_token = stop_token_of(awaiting_coro);
+            if (stop_token.stop_requested())
+            {
+                cancelled = true;
+                return false;
+            }
+
+            coro_handle = awaiting_coro;
+            scheduling = scheduling_of(awaiting_coro);
+            scheduler->enqueue_fetch(*this);
+            watch(std::move(stop_token));
+            return true;
+        }
+
+        int await_resume()
+        {
+            finish();
+            return value;
+        }
+
+        static bool unlink(CancellableAwait& self)
+        {
+            auto& awaiter = static_cast<FetchAwaiter&>(self);
+            if (!awaiter.queued)
+                return false;
+
+            awaiter.scheduler->dequeue_fetch(awaiter);
+            return true;
+        }
+    };
+
+    struct SleepAwaiter : CancellableAwait
+    {
+        Clock::time_point deadline;
+        TimerNode timer;
+
+        SleepAwaiter(Scheduler& scheduler, Clock::time_point deadline)
+            : CancellableAwait{scheduler, &SleepAwaiter::disarm}
+            , deadline{deadline}
+        { }
+
+        bool await_ready() const { return deadline <= Clock::now(); }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            std::stop_token stop_token = stop_token_of(awaiting_coro);
+            if (stop_token.stop_requested())
+            {
+                cancelled = true;
+                return false;
+            }
+
+            coro_handle = awaiting_coro;
+            scheduling = scheduling_of(awaiting_coro);
+            timer.context = this;
+            timer.on_expired = [](TimerNode& node) {
+                auto* self = static_cast<SleepAwaiter*>(node.context);
+                self->scheduler->submit_coro(self->coro_handle, self->scheduling);
+            };
+            scheduler->schedule_timer(timer, deadline);
+            watch(std::move(stop_token));
+            return true;
+        }
+
+        void await_resume() { finish(); }
+
+        static bool disarm(CancellableAwait& self)
+        {
+            auto& awaiter = static_cast<SleepAwaiter&>(self);
+            if (!awaiter.timer.is_armed())
+                return false;
+
+            awaiter.scheduler->cancel_timer(awaiter.timer);
+            return true;
+        }
+    };
+
+    // I/O operation started by the scheduler - the completed coroutine keeps its priority
+    struct ScheduledIoOperation : IoOperation
+    {
+        TaskScheduling scheduling;
+    };
+
+    struct IoAwaiter
+    {
+        Scheduler& scheduler;
+        ScheduledIoOperation operation;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> coro_handle)
+        {
+            operation.coro_handle = coro_handle;
+            operation.scheduling = scheduling_of(coro_handle);
+            scheduler.io_.start(operation);
+        }
+
+        std::size_t await_resume() const
+        {
+            if (operation.result < 0)
+                throw std::system_error{static_cast<int>(-operation.result), std::system_category(),
+                    operation.kind == IoOperation::Kind::read ? "read" : "write"};
+
+            return static_cast<std::size_t>(operation.result);
+        }
+    };
+
+    std::mutex mtx_;
+    std::condition_variable cv_ready_;
+    ReadyQueue ready_coroutines_;
+    std::atomic<std::uint32_t> ready_bands_{0}; // ready_coroutines_.bands() - checked by run() without the lock
+    SchedulingPolicy scheduling_policy_;
+    bool parked_in_io_ = false;
+    std::atomic<std::size_t> pending_tasks_{0};
+    std::size_t resume_count_ = 0;
+    FramePool frame_arena_;
+    const Clock::time_point start_time_ = Clock::now();
+    TimerWheel timers_;
+    IoService io_;
+
+    FetchBatching fetch_batching_;
+    FetchBatchStats fetch_stats_;
+    CancellableAwait* deferred_cancellations_ = nullptr; // guarded by mtx_
+    FetchAwaiter* fetch_head_ = nullptr;
+    FetchAwaiter* fetch_tail_ = nullptr;
+    std::size_t fetch_batch_size_ = 0;
+    Clock::time_point fetch_batch_started_;
+    TimerNode fetch_linger_timer_;
+    std::vector<int> fetched_values_;
+    std::mt19937 rnd_gen_{std::random_device{}()};
+
+#if COROUTINES_TRACING
+    SchedulerTracer tracer_;
+#endif
+
+    static inline thread_local Scheduler* current_ = nullptr;
+
+    // under mtx_
+    void push_ready(std::coroutine_handle<> coro_handle, TaskScheduling scheduling)
+    {
+        ready_coroutines_.push(coro_handle, scheduling);
+        ready_bands_.store(ready_coroutines_.bands(), std::memory_order_relaxed);
+    }
+
+    // under mtx_
+    void take_ready(ReadyQueue& tick)
+    {
+        tick.splice(ready_coroutines_);
+        ready_bands_.store(0, std::memory_order_relaxed);
+    }
+
+    void resume(std::coroutine_handle<> coro_handle)
+    {
+#if COROUTINES_TRACING
+        const auto resume_start = Clock::now();
+        coro_handle.resume();
+        tracer_.on_resumed(coro_handle.address(), resume_start, Clock::now());
+#else
+        coro_handle.resume();
+#endif
+        ++resume_count_;
+    }
+
+    // called on the scheduler thread (from await_suspend())
+    void enqueue_fetch(FetchAwaiter& awaiter)
+    {
+        awaiter.queued = true;
+        awaiter.prev = fetch_tail_;
+        awaiter.next = nullptr;
+
+        if (fetch_tail_)
+            fetch_tail_->next = &awaiter;
+        else
+        {
+            fetch_head_ = &awaiter;
+            fetch_batch_started_ = Clock::now();
+            if (fetch_batching_.max_linger > Clock::duration::zero())
+                schedule_timer(fetch_linger_timer_, fetch_batch_started_ + fetch_batching_.max_linger);
+        }
+        fetch_tail_ = &awaiter;
+
+        if (++fetch_batch_size_ == fetch_batching_.max_batch_size)
+        {
+            ++fetch_stats_.full_batches;
+            fetch_batch();
+        }
+    }
+
+    // cancelled request
+    void dequeue_fetch(FetchAwaiter& awaiter)
+    {
+        (awaiter.prev ? awaiter.prev->next : fetch_head_) = awaiter.next;
+        (awaiter.next ? awaiter.next->prev : fetch_tail_) = awaiter.prev;
+        awaiter.queued = false;
+
+        if (--fetch_batch_size_ == 0)
+            cancel_timer(fetch_linger_timer_);
+    }
+
+    // the backend call - one request for the whole batch
+    void fetch_values(std::span<int> values)
+    {
+        std::uniform_int_distribution<> distr(1, 100);
+        for (int& value : values)
+            value = distr(rnd_gen_);
+    }
+
+    void fetch_batch()
+    {
+        if (!fetch_head_)
+            return;
+
+        cancel_timer(fetch_linger_timer_);
+
+        fetched_values_.resize(fetch_batch_size_);
+        fetch_values(fetched_values_);
+
+        fetch_stats_.batches += 1;
+        fetch_stats_.requests += fetch_batch_size_;
+        fetch_stats_.largest_batch = std::max(fetch_stats_.largest_batch, fetch_batch_size_);
+        fetch_stats_.total_linger += Clock::now() - fetch_batch_started_;
+
+        {
+            std::lock_guard lk{mtx_}; // on the scheduler thread - nobody to notify
+            std::size_t index = 0;
+            for (FetchAwaiter* awaiter = std::exchange(fetch_head_, nullptr); awaiter; awaiter = awaiter->next)
+            {
+                awaiter->value = fetched_values_[index++];
+                awaiter->queued = false;
+                push_ready(awaiter->coro_handle, awaiter->scheduling);
+            }
+        }
+
+        fetch_tail_ = nullptr;
+        fetch_batch_size_ = 0;
+    }
+
+    // called by the stop callback of a pending awaiter (on the thread requesting the stop)
+    void request_cancellation(CancellableAwait& awaiter)
+    {
+        if (current_ == this)
+        {
+            cancel_now(awaiter);
+            return;
+        }
+
+        bool parked_in_io;
+        {
+            std::lock_guard lk{mtx_};
+            awaiter.deferred = true;
+            awaiter.next_deferred = std::exchange(deferred_cancellations_, &awaiter);
+            parked_in_io = parked_in_io_;
+        }
+        cv_ready_.notify_one();
+
+        if (parked_in_io)
+            io_.wake();
+    }
+
+    // a resumed awaiter must not stay on the list of deferred cancellations
+    void forget_cancellation(CancellableAwait& awaiter)
+    {
+        std::lock_guard lk{mtx_};
+        if (!awaiter.deferred)
+            return;
+
+        CancellableAwait** link = &deferred_cancellations_;
+        while (*link != &awaiter)
+            link = &(*link)->next_deferred;
+        *link = awaiter.next_deferred;
+        awaiter.deferred = false;
+    }
+
+    void cancel_now(CancellableAwait& awaiter)
+    {
+        if (!awaiter.cancel(awaiter)) // already completed - it will be resumed normally
+            return;
+
+        awaiter.cancelled = true;
+        submit_coro(awaiter.coro_handle, awaiter.scheduling);
+    }
+
+    // cancellations requested from other threads
+    void cancel_deferred()
+    {
+        CancellableAwait* awaiter;
+        {
+            std::lock_guard lk{mtx_};
+            awaiter = std::exchange(deferred_cancellations_, nullptr);
+            for (CancellableAwait* it = awaiter; it; it = it->next_deferred)
+                it->deferred = false;
+        }
+
+        while (awaiter)
+            cancel_now(*std::exchange(awaiter, awaiter->next_deferred));
+    }
+
+    // tick at (or after) which a deadline has passed
+    std::uint64_t tick_of(Clock::time_point deadline) const
+    {
+        if (deadline <= start_time_)
+            return 0;
+        return static_cast<std::uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(deadline - start_time_) / tick_duration);
+    }
+
+    std::uint64_t elapsed_ticks() const
+    {
+        return static_cast<std::uint64_t>(std::chrono::floor<std::chrono::milliseconds>(Clock::now() - start_time_) / tick_duration);
+    }
+
+    // parks until a coroutine becomes ready, I/O completes or the next timer expires
+    void wait_for_events(std::unique_lock<std::mutex>& lk)
+    {
+        std::optional<Clock::time_point> deadline;
+        if (auto next_tick = timers_.next_expiry())
+            deadline = start_time_ + *next_tick * tick_duration;
+
+        auto is_ready = [this] {
+            return !ready_coroutines_.empty() || deferred_cancellations_ || pending_tasks_.load(std::memory_order_acquire) == 0;
+        };
+
+        if (io_.in_flight() > 0)
+        {
+            parked_in_io_ = true;
+            lk.unlock();
+            io_.wait(deadline);
+            lk.lock();
+            parked_in_io_ = false;
+        }
+        else if (deadline)
+            cv_ready_.wait_until(lk, *deadline, is_ready);
+        else
+            cv_ready_.wait(lk, is_ready);
+    }
+
+    static void on_io_completed(void* context, IoOperation& operation)
+    {
+        auto& scheduled_operation = static_cast<ScheduledIoOperation&>(operation);
+        static_cast<Scheduler*>(context)->submit_coro(scheduled_operation.coro_handle, scheduled_operation.scheduling);
+    }
+};
+
+namespace details
+{
+    template <typename TAwaitable>
+    Task<std::remove_cvref_t<await_result_t<TAwaitable>>> as_task(TAwaitable awaitable)
+    {
+        co_return co_await std::move(awaitable);
+    }
+
+    inline Task<> sleep_task(Scheduler& scheduler, Scheduler::Clock::duration duration)
+    {
+        co_await scheduler.sleep_for(duration);
+    }
+} // namespace details
+
+// co_await with_timeout(awaitable, 100ms) - must be awaited by a coroutine running on a Scheduler:
+//  - the result of the awaitable wrapped in std::optional (bool for void awaitables); empty/false on timeout
+//  - an exception thrown by the awaitable before the deadline is rethrown
+// the awaitable and the timer race in when_any() - the loser is cancelled
+template <typename TAwaitable>
+auto with_timeout(TAwaitable awaitable, Scheduler::Clock::duration timeout)
+    -> Task<std::conditional_t<std::is_void_v<await_result_t<TAwaitable>>, bool, std::optional<std::remove_cvref_t<await_result_t<TAwaitable>>>>>
+{
+    auto result = co_await when_any(details::as_task(std::move(awaitable)), details::sleep_task(*Scheduler::current(), timeout));
+
+    if constexpr (std::is_void_v<await_result_t<TAwaitable>>)
+        co_return result.index() == 0;
+    else
+    {
+        if (result.index() != 0)
+            co_return std::nullopt;
+        co_return std::move(std::get<0>(result));
+    }
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef SCHEDULER_REF_HPP
+#define SCHEDULER_REF_HPP
+
+#include "task.hpp"
+
+#include <coroutine>
+
+// Non-owning reference to any scheduler with submit_coro() - synchronization primitives (Channel, AsyncMutex, ...)
+// hand woken coroutines back to it, keeping their TaskScheduling if the scheduler supports priorities
+class SchedulerRef
+{
+public:
+    template <typename TScheduler>
+        requires requires(TScheduler& scheduler, std::coroutine_handle<> coro_handle) { scheduler.submit_coro(coro_handle); }
+    SchedulerRef(TScheduler& scheduler)
+        : scheduler_{&scheduler}
+        , submit_{[](void* scheduler, std::coroutine_handle<> coro_handle, TaskScheduling scheduling) {
+            if constexpr (requires(TScheduler& s) { s.submit_coro(coro_handle, scheduling); })
+                static_cast<TScheduler*>(scheduler)->submit_coro(coro_handle, scheduling);
+            else
+                static_cast<TScheduler*>(scheduler)->submit_coro(coro_handle);
+        }}
+    { }
+
+    void submit(std::coroutine_handle<> coro_handle, TaskScheduling scheduling = {}) const
+    {
+        submit_(scheduler_, coro_handle, scheduling);
+    }
+
+private:
+    void* scheduler_;
+    void (*submit_)(void* scheduler, std::coroutine_handle<> coro_handle, TaskScheduling scheduling);
+};
+
+#endif
@@ -0,0 +1,154 @@
+#include "scheduler.hpp"
+#include "scheduler_trace.hpp"
+#include "task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("SchedulerTracer", "[coroutines][tracing]")
+{
+    SchedulerTracer tracer{4};
+    const auto t0 = SchedulerTracer::Clock::now();
+
+    int first = 0, second = 0;
+    tracer.on_task_submitted(&first, 128);
+
+    tracer.on_tick(2);
+    tracer.on_resumed(&first, t0, t0 + 2ms);
+    tracer.on_resumed(&second, t0 + 2ms, t0 + 3ms);
+    tracer.end_tick();
+
+    tracer.on_tick(1);
+    tracer.on_resumed(&first, t0 + 10ms, t0 + 14ms);
+    tracer.end_tick();
+
+    SECTION("per coroutine statistics")
+    {
+        const auto snapshot = tracer.snapshot();
+
+        CHECK(snapshot.total_resumes == 3);
+        CHECK(snapshot.total_resume_time == 7ms);
+
+        const CoroutineTraceStats* stats = snapshot.find(&first);
+        REQUIRE(stats);
+        CHECK(stats->frame_size == 128);
+        CHECK(stats->resumes == 2);
+        CHECK(stats->total_resume_time == 6ms);
+        CHECK(stats->max_resume_time == 4ms);
+        CHECK(stats->total_suspended_time == 8ms);
+
+        REQUIRE(snapshot.find(&second));
+        CHECK(snapshot.find(&second)->frame_size == 0);
+    }
+
+    SECTION("run queue depth")
+    {
+        const auto snapshot = tracer.snapshot();
+
+        REQUIRE(snapshot.run_queue.size() == 2);
+        CHECK(snapshot.run_queue[0].depth == 2);
+        CHECK(snapshot.run_queue[1].depth == 1);
+    }
+
+    SECTION("history is bounded")
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            tracer.on_tick(1);
+            tracer.on_resumed(&second, t0 + 20ms, t0 + 21ms);
+            tracer.end_tick();
+        }
+
+        const auto snapshot = tracer.snapshot();
+        CHECK(snapshot.recent_resumes.size() == 4);
+        CHECK(snapshot.run_queue.size() == 4);
+        CHECK(snapshot.total_resumes == 13);
+    }
+
+    SECTION("statistics are kept for the most recently resumed coroutines")
+    {
+        int others[5] = {};
+        tracer.on_tick(5);
+        tracer.on_resumed(&first, t0 + 20ms, t0 + 21ms);
+        for (int& other : others)
+            tracer.on_resumed(&other, t0 + 21ms, t0 + 22ms);
+        tracer.end_tick();
+
+        const auto snapshot = tracer.snapshot();
+        CHECK(snapshot.coroutines.size() == 4);
+        CHECK_FALSE(snapshot.find(&second));
+        CHECK_FALSE(snapshot.find(&first));
+        CHECK_FALSE(snapshot.find(&others[0]));
+        CHECK(snapshot.find(&others[4]));
+    }
+
+    SECTION("a submitted task in a recycled frame starts a new record")
+    {
+        tracer.on_task_submitted(&first, 256);
+
+        const auto snapshot = tracer.snapshot();
+        const CoroutineTraceStats* stats = snapshot.find(&first);
+        REQUIRE(stats);
+        CHECK(stats->frame_size == 256);
+        CHECK(stats->resumes == 0);
+    }
+
+    SECTION("chrome trace")
+    {
+        std::ostringstream out;
+        tracer.snapshot().write_chrome_trace(out);
+        const std::string json = out.str();
+
+        CHECK(json.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[{"name":"resume")"));
+        CHECK(json.ends_with("}]}"));
+        CHECK(json.find(R"("ph":"X")") != std::string::npos);
+        CHECK(json.find(R"("name":"run queue","ph":"C")") != std::string::npos);
+        CHECK(json.find(R"("frame_size":128)") != std::string::npos);
+    }
+}
+
+#if COROUTINES_TRACING
+namespace
+{
+    Task<int> traced_task(Scheduler& scheduler)
+    {
+        int sum = co_await scheduler.fetch_data();
+        co_await scheduler.sleep_for(2ms);
+        sum += co_await scheduler.fetch_data();
+        co_return sum;
+    }
+} // namespace
+
+TEST_CASE("Scheduler - tracing", "[coroutines][tracing]")
+{
+    Scheduler scheduler;
+
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < 10; ++i)
+        tasks.push_back(traced_task(scheduler));
+    for (auto& task : tasks)
+        scheduler.submit_task(task);
+
+    scheduler.run();
+
+    const auto snapshot = scheduler.trace_snapshot();
+    CHECK(snapshot.total_resumes == scheduler.resume_count());
+    CHECK(snapshot.total_resumes == 40);
+
+    for (auto& task : tasks)
+    {
+        const CoroutineTraceStats* stats = snapshot.find(task.get_coro_handle().address());
+        REQUIRE(stats);
+        CHECK(stats->resumes == 4);
+        CHECK(stats->frame_size > 0);
+        CHECK(stats->max_suspended_time >= 2ms);
+    }
+
+    CHECK(snapshot.run_queue.front().depth == 10);
+}
+#endif
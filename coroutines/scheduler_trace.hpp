@@ -0,0 +1,237 @@
+#ifndef SCHEDULER_TRACE_HPP
+#define SCHEDULER_TRACE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iomanip>
+#include <list>
+#include <ios>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+// Scheduler instrumentation switch - set by the COROUTINES_ENABLE_TRACING CMake option;
+// with 0 the Scheduler contains no tracing code nor data
+#ifndef COROUTINES_TRACING
+#define COROUTINES_TRACING 0
+#endif
+
+struct CoroutineTraceStats
+{
+    using Duration = std::chrono::steady_clock::duration;
+
+    // frame address - FramePool recycles frames, so ids are reused: a task submitted to the scheduler starts
+    // a new record, other coroutines in a recycled frame continue the record of its previous coroutine
+    const void* id = nullptr;
+    std::size_t frame_size = 0; // known for tasks submitted to the scheduler (0 - unknown)
+    std::size_t resumes = 0;
+    Duration total_resume_time{};
+    Duration max_resume_time{};
+    Duration total_suspended_time{}; // from the end of a resume to the start of the next one
+    Duration max_suspended_time{};
+};
+
+struct RunQueueSample
+{
+    std::chrono::steady_clock::duration timestamp; // since the tracer was created
+    std::size_t depth;
+};
+
+struct ResumeTraceEvent
+{
+    const void* id;
+    std::chrono::steady_clock::duration start; // since the tracer was created
+    std::chrono::steady_clock::duration duration;
+};
+
+struct SchedulerTraceSnapshot
+{
+    std::vector<CoroutineTraceStats> coroutines;
+    std::vector<RunQueueSample> run_queue;       // the most recent ticks
+    std::vector<ResumeTraceEvent> recent_resumes; // the most recent resumes
+    std::size_t total_resumes = 0;
+    std::chrono::steady_clock::duration total_resume_time{};
+
+    const CoroutineTraceStats* find(const void* id) const
+    {
+        auto it = std::ranges::find(coroutines, id, &CoroutineTraceStats::id);
+        return it != coroutines.end() ? &*it : nullptr;
+    }
+
+    // Trace Event Format (chrome://tracing, Perfetto): resumes as complete events, run queue depth as a counter
+    void write_chrome_trace(std::ostream& out) const
+    {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed << std::setprecision(3);
+
+        auto to_us = [](std::chrono::steady_clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); };
+
+        out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+        const char* separator = "";
+        for (const auto& event : recent_resumes)
+        {
+            const CoroutineTraceStats* stats = find(event.id);
+            out << separator << R"({"name":"resume","cat":"coroutine","ph":"X","pid":1,"tid":1,"ts":)" << to_us(event.start)
+                << R"(,"dur":)" << to_us(event.duration) << R"(,"args":{"coroutine":")" << event.id
+                << R"(","frame_size":)" << (stats ? stats->frame_size : 0) << "}}";
+            separator = ",";
+        }
+
+        for (const auto& sample : run_queue)
+        {
+            out << separator << R"({"name":"run queue","ph":"C","pid":1,"tid":1,"ts":)" << to_us(sample.timestamp)
+                << R"(,"args":{"depth":)" << sample.depth << "}}";
+            separator = ",";
+        }
+
+        out << "]}";
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+};
+
+// Collects Scheduler metrics:
+//  - on_tick()/on_resumed() are called on the scheduler thread and buffered for the current tick,
+//    end_tick() merges the buffer under a mutex (one lock per tick)
+//  - snapshot() may be called from any thread at any time (pull API)
+//  - resume events and run queue samples are kept in bounded buffers (the most recent ones),
+//    statistics are kept for the most recently resumed (or submitted) coroutines only - completions are not traced
+class SchedulerTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit SchedulerTracer(std::size_t history_capacity = 64 * 1024)
+        : history_capacity_{std::max<std::size_t>(history_capacity, 1)}
+    { }
+
+    SchedulerTracer(const SchedulerTracer&) = delete;
+    SchedulerTracer& operator=(const SchedulerTracer&) = delete;
+
+    // may be called from any thread
+    void on_task_submitted(const void* id, std::size_t frame_size)
+    {
+        std::lock_guard lk{mtx_};
+        Record& record = touch(id);
+        record.stats = CoroutineTraceStats{id, frame_size};
+        record.last_suspended = {};
+    }
+
+    void on_tick(std::size_t run_queue_depth)
+    {
+        tick_depth_ = run_queue_depth;
+        tick_start_ = Clock::now();
+    }
+
+    void on_resumed(const void* id, Clock::time_point start, Clock::time_point end)
+    {
+        tick_events_.push_back({id, start - start_time_, end - start});
+    }
+
+    void end_tick()
+    {
+        std::lock_guard lk{mtx_};
+
+        push_bounded(run_queue_, RunQueueSample{tick_start_ - start_time_, tick_depth_});
+
+        for (const auto& event : tick_events_)
+        {
+            Record& record = touch(event.id);
+            CoroutineTraceStats& stats = record.stats;
+            stats.id = event.id;
+
+            if (stats.resumes > 0)
+            {
+                const auto suspended = event.start - record.last_suspended;
+                stats.total_suspended_time += suspended;
+                stats.max_suspended_time = std::max(stats.max_suspended_time, suspended);
+            }
+
+            ++stats.resumes;
+            stats.total_resume_time += event.duration;
+            stats.max_resume_time = std::max(stats.max_resume_time, event.duration);
+            record.last_suspended = event.start + event.duration;
+
+            ++total_resumes_;
+            total_resume_time_ += event.duration;
+            push_bounded(recent_resumes_, event);
+        }
+
+        tick_events_.clear();
+    }
+
+    SchedulerTraceSnapshot snapshot() const
+    {
+        std::lock_guard lk{mtx_};
+
+        SchedulerTraceSnapshot snapshot;
+        snapshot.coroutines.reserve(coroutines_.size());
+        for (const auto& [id, record] : coroutines_)
+            snapshot.coroutines.push_back(record.stats);
+        snapshot.run_queue.assign(run_queue_.begin(), run_queue_.end());
+        snapshot.recent_resumes.assign(recent_resumes_.begin(), recent_resumes_.end());
+        snapshot.total_resumes = total_resumes_;
+        snapshot.total_resume_time = total_resume_time_;
+
+        return snapshot;
+    }
+
+private:
+    struct Record
+    {
+        CoroutineTraceStats stats;
+        Clock::duration last_suspended{}; // end of the last resume (since start_time_)
+        std::list<const void*>::iterator position; // in recently_used_
+    };
+
+    const Clock::time_point start_time_ = Clock::now();
+    const std::size_t history_capacity_;
+
+    // scheduler thread only
+    std::vector<ResumeTraceEvent> tick_events_;
+    std::size_t tick_depth_ = 0;
+    Clock::time_point tick_start_;
+
+    mutable std::mutex mtx_;
+    std::unordered_map<const void*, Record> coroutines_;
+    std::list<const void*> recently_used_; // ids of coroutines_ - the least recently used first
+    std::deque<RunQueueSample> run_queue_;
+    std::deque<ResumeTraceEvent> recent_resumes_;
+    std::size_t total_resumes_ = 0;
+    Clock::duration total_resume_time_{};
+
+    // record of id moved to the end of recently_used_ - a new one evicts the least recently used record when full
+    Record& touch(const void* id)
+    {
+        auto [it, inserted] = coroutines_.try_emplace(id);
+        if (!inserted)
+        {
+            recently_used_.splice(recently_used_.end(), recently_used_, it->second.position);
+            return it->second;
+        }
+
+        if (coroutines_.size() > history_capacity_)
+        {
+            coroutines_.erase(recently_used_.front());
+            recently_used_.pop_front();
+        }
+        it->second.position = recently_used_.insert(recently_used_.end(), id);
+        return it->second;
+    }
+
+    template <typename T>
+    void push_bounded(std::deque<T>& buffer, const T& item)
+    {
+        if (buffer.size() == history_capacity_)
+            buffer.pop_front();
+        buffer.push_back(item);
+    }
+};
+
+#endif
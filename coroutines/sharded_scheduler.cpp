@@ -0,0 +1,104 @@
+#include "sharded_scheduler.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("spsc ring", "[coroutines][scheduler]")
+{
+    SpscRing<int> ring{4};
+
+    for (int i = 0; i < 4; ++i)
+        CHECK(ring.try_push(i));
+    CHECK_FALSE(ring.try_push(4));
+
+    int item = -1;
+    CHECK(ring.try_pop(item));
+    CHECK(item == 0);
+    CHECK(ring.try_push(4));
+
+    std::vector<int> rest;
+    while (ring.try_pop(item))
+        rest.push_back(item);
+    CHECK(rest == std::vector{1, 2, 3, 4});
+}
+
+namespace
+{
+    struct HopStats
+    {
+        std::atomic<int> completions{0};
+        std::atomic<int> misplaced_steps{0};
+    };
+
+    Task<> hopping_coro(std::size_t id, ShardedScheduler& scheduler, HopStats& stats)
+    {
+        for (std::size_t hop = 0; hop < 2 * scheduler.shard_count(); ++hop)
+        {
+            const std::size_t target_shard = (id + hop) % scheduler.shard_count();
+
+            co_await scheduler.on_shard(target_shard);
+            if (scheduler.current_shard() != target_shard)
+                stats.misplaced_steps.fetch_add(1);
+
+            co_await scheduler.fetch_data(); // stays on the same shard
+            if (scheduler.current_shard() != target_shard)
+                stats.misplaced_steps.fetch_add(1);
+        }
+
+        stats.completions.fetch_add(1);
+    }
+
+    void run_hopping_tasks(ShardedScheduler& scheduler, std::size_t task_count)
+    {
+        HopStats stats;
+
+        std::vector<Task<>> tasks;
+        tasks.reserve(task_count);
+
+        for (std::size_t id = 0; id < task_count; ++id)
+        {
+            tasks.push_back(hopping_coro(id, scheduler, stats));
+            scheduler.submit_task(tasks.back());
+        }
+
+        scheduler.run();
+
+        CHECK(stats.completions == static_cast<int>(task_count));
+        CHECK(stats.misplaced_steps == 0);
+        CHECK(std::ranges::all_of(tasks, [](const Task<>& t) { return t.get_coro_handle().done(); }));
+    }
+} // namespace
+
+TEST_CASE("sharded scheduler - coroutines hop between shards", "[coroutines][scheduler]")
+{
+    SECTION("default mailboxes")
+    {
+        ShardedScheduler scheduler{4};
+        run_hopping_tasks(scheduler, 1'000);
+    }
+
+    SECTION("tiny mailboxes overflow to the sending shard")
+    {
+        ShardedScheduler scheduler{3, false, 2};
+        run_hopping_tasks(scheduler, 500);
+    }
+
+    SECTION("pinned shards")
+    {
+        ShardedScheduler scheduler{2, true};
+        run_hopping_tasks(scheduler, 100);
+    }
+}
+
+TEST_CASE("sharded scheduler - current_shard outside of run", "[coroutines][scheduler]")
+{
+    ShardedScheduler scheduler{2};
+
+    CHECK(scheduler.current_shard() == std::nullopt);
+}
@@ -0,0 +1,392 @@
+#ifndef SHARDED_SCHEDULER_HPP
+#define SHARDED_SCHEDULER_HPP
+
+#include "task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Bounded lock-free single-producer/single-consumer ring buffer
+template <typename T>
+class SpscRing
+{
+public:
+    explicit SpscRing(std::size_t capacity)
+        : buffer_(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+        , mask_{buffer_.size() - 1}
+    { }
+
+    // producer side
+    bool try_push(const T& item)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail - cached_head_ == buffer_.size())
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == buffer_.size())
+                return false;
+        }
+
+        buffer_[tail & mask_] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side
+    bool try_pop(T& item)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+
+        if (head == cached_tail_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+                return false;
+        }
+
+        item = buffer_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> buffer_;
+    const std::size_t mask_;
+
+    alignas(64) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0; // owned by the consumer
+
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0; // owned by the producer
+};
+
+// Shared-nothing (thread-per-core) scheduler:
+//  - every shard is a thread that owns its ready queue - no locks on the hot path
+//  - a coroutine hops to another shard with co_await scheduler.on_shard(n); the handle travels
+//    through a dedicated SPSC mailbox for each (source, destination) pair of shards
+//  - threads submitting from outside the shards use a mutex-protected inbox
+class ShardedScheduler
+{
+public:
+    explicit ShardedScheduler(std::size_t shard_count, bool pin_to_cores = false, std::size_t mailbox_capacity = 1024)
+        : shard_count_{std::max<std::size_t>(shard_count, 1)}
+        , pin_to_cores_{pin_to_cores}
+    {
+        shards_.reserve(shard_count_);
+        for (std::size_t i = 0; i < shard_count_; ++i)
+            shards_.push_back(std::make_unique<Shard>(shard_count_));
+
+        mailboxes_.reserve(shard_count_ * shard_count_);
+        for (std::size_t i = 0; i < shard_count_ * shard_count_; ++i)
+            mailboxes_.push_back(std::make_unique<SpscRing<std::coroutine_handle<>>>(mailbox_capacity));
+    }
+
+    ShardedScheduler(const ShardedScheduler&) = delete;
+    ShardedScheduler& operator=(const ShardedScheduler&) = delete;
+
+    std::size_t shard_count() const
+    {
+        return shard_count_;
+    }
+
+    // index of the shard running the calling thread (nullopt outside of run())
+    std::optional<std::size_t> current_shard() const
+    {
+        if (current_.scheduler == this)
+            return current_.shard_index;
+        return std::nullopt;
+    }
+
+    void submit_coro(std::coroutine_handle<> coro_handle, std::size_t shard_index)
+    {
+        if (current_.scheduler != this)
+        {
+            Shard& target = *shards_[shard_index];
+            {
+                std::lock_guard lk{target.inbox_mtx};
+                target.inbox.push_back(coro_handle);
+                target.has_inbox.store(true, std::memory_order_release);
+            }
+            wake(target);
+            return;
+        }
+
+        const std::size_t source_index = current_.shard_index;
+        Shard& source = *shards_[source_index];
+
+        if (source_index == shard_index)
+        {
+            source.ready.push_back(coro_handle);
+        }
+        else if (!mailbox(source_index, shard_index).try_push(coro_handle))
+        {
+            source.overflow[shard_index].push_back(coro_handle); // retried by the owner of the source shard
+        }
+        else
+        {
+            wake(*shards_[shard_index]);
+        }
+    }
+
+    void submit_coro(std::coroutine_handle<> coro_handle)
+    {
+        if (current_.scheduler == this)
+            submit_coro(coro_handle, current_.shard_index);
+        else
+            submit_coro(coro_handle, next_shard_.fetch_add(1, std::memory_order_relaxed) % shard_count_);
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task, std::size_t shard_index)
+    {
+        auto coro_handle = task.get_coro_handle();
+        coro_handle.promise().pending_tasks_counter = &pending_tasks_;
+        pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+        submit_coro(coro_handle, shard_index);
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task)
+    {
+        submit_task(task, next_shard_.fetch_add(1, std::memory_order_relaxed) % shard_count_);
+    }
+
+    // co_await scheduler.on_shard(n) - continues the coroutine on the n-th shard
+    auto on_shard(std::size_t shard_index)
+    {
+        struct ShardHopAwaiter
+        {
+            ShardedScheduler& scheduler;
+            std::size_t shard_index;
+
+            bool await_ready() const
+            {
+                return scheduler.current_shard() == shard_index;
+            }
+
+            void await_suspend(std::coroutine_handle<> coro_handle)
+            {
+                scheduler.submit_coro(coro_handle, shard_index);
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        return ShardHopAwaiter{*this, shard_index % shard_count_};
+    }
+
+    auto fetch_data()
+    {
+        struct ValueAwaiter
+        {
+            ShardedScheduler& scheduler;
+
+            bool await_ready() { return false; }
+
+            void await_suspend(std::coroutine_handle<> coro_handle)
+            {
+                scheduler.submit_coro(coro_handle);
+            }
+
+            int await_resume()
+            {
+                std::random_device rd;
+                std::mt19937 rnd_gen(rd());
+                std::uniform_int_distribution<> distr(1, 100);
+                return distr(rnd_gen);
+            }
+        };
+
+        return ValueAwaiter{*this};
+    }
+
+    void run()
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(shard_count_);
+
+        for (std::size_t i = 0; i < shard_count_; ++i)
+            threads.emplace_back([this, i] { shard_loop(i); });
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        std::deque<std::coroutine_handle<>> ready;                  // owned by the shard thread
+        std::vector<std::deque<std::coroutine_handle<>>> overflow; // handles that did not fit into a full mailbox
+
+        std::mutex inbox_mtx;
+        std::vector<std::coroutine_handle<>> inbox; // submissions from non-shard threads
+        std::atomic<bool> has_inbox{false};
+
+        alignas(64) std::atomic<std::uint32_t> wakeup_signal{0};
+        std::atomic<bool> sleeping{false};
+
+        explicit Shard(std::size_t shard_count)
+            : overflow(shard_count)
+        { }
+    };
+
+    struct ShardContext
+    {
+        ShardedScheduler* scheduler;
+        std::size_t shard_index;
+    };
+
+    inline static thread_local ShardContext current_; // zero-initialized
+
+    const std::size_t shard_count_;
+    const bool pin_to_cores_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::vector<std::unique_ptr<SpscRing<std::coroutine_handle<>>>> mailboxes_; // [source * shard_count + destination]
+    std::atomic<std::size_t> pending_tasks_{0};
+    std::atomic<std::size_t> next_shard_{0};
+
+    SpscRing<std::coroutine_handle<>>& mailbox(std::size_t source_index, std::size_t destination_index)
+    {
+        return *mailboxes_[source_index * shard_count_ + destination_index];
+    }
+
+    void wake(Shard& shard)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (shard.sleeping.load(std::memory_order_relaxed))
+        {
+            shard.wakeup_signal.fetch_add(1, std::memory_order_release);
+            shard.wakeup_signal.notify_one();
+        }
+    }
+
+    // moves handles delivered by other shards to the local ready queue; returns false if some
+    // handles could not be forwarded because of full mailboxes
+    bool exchange_mail(std::size_t index)
+    {
+        Shard& shard = *shards_[index];
+        std::coroutine_handle<> coro_handle;
+
+        for (std::size_t source_index = 0; source_index < shard_count_; ++source_index)
+        {
+            if (source_index == index)
+                continue;
+
+            auto& incoming = mailbox(source_index, index);
+            while (incoming.try_pop(coro_handle))
+                shard.ready.push_back(coro_handle);
+        }
+
+        if (shard.has_inbox.load(std::memory_order_acquire))
+        {
+            std::lock_guard lk{shard.inbox_mtx};
+            shard.ready.insert(shard.ready.end(), shard.inbox.begin(), shard.inbox.end());
+            shard.inbox.clear();
+            shard.has_inbox.store(false, std::memory_order_relaxed);
+        }
+
+        bool all_forwarded = true;
+
+        for (std::size_t destination_index = 0; destination_index < shard_count_; ++destination_index)
+        {
+            auto& pending = shard.overflow[destination_index];
+            if (pending.empty())
+                continue;
+
+            auto& outgoing = mailbox(index, destination_index);
+            while (!pending.empty() && outgoing.try_push(pending.front()))
+                pending.pop_front();
+
+            wake(*shards_[destination_index]);
+            all_forwarded = all_forwarded && pending.empty();
+        }
+
+        return all_forwarded;
+    }
+
+    void pin_current_thread(std::size_t index)
+    {
+#ifdef __linux__
+        const unsigned core_count = std::max(1u, std::thread::hardware_concurrency());
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(index % core_count, &cpu_set);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#else
+        (void)index;
+#endif
+    }
+
+    void wake_all()
+    {
+        for (auto& shard : shards_)
+        {
+            shard->wakeup_signal.fetch_add(1, std::memory_order_release);
+            shard->wakeup_signal.notify_all();
+        }
+    }
+
+    void shard_loop(std::size_t index)
+    {
+        if (pin_to_cores_)
+            pin_current_thread(index);
+
+        current_ = ShardContext{this, index};
+        Shard& shard = *shards_[index];
+
+        while (true)
+        {
+            const bool all_forwarded = exchange_mail(index);
+
+            if (!shard.ready.empty())
+            {
+                auto coro_handle = shard.ready.front();
+                shard.ready.pop_front();
+                coro_handle.resume();
+                continue;
+            }
+
+            if (pending_tasks_.load(std::memory_order_acquire) == 0)
+                break;
+
+            if (!all_forwarded)
+            {
+                std::this_thread::yield(); // destination shard has to drain its mailbox first
+                continue;
+            }
+
+            // park until another shard (or an external thread) sends something
+            const std::uint32_t signal = shard.wakeup_signal.load(std::memory_order_acquire);
+            shard.sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            exchange_mail(index);
+
+            if (shard.ready.empty() && pending_tasks_.load(std::memory_order_acquire) != 0)
+                shard.wakeup_signal.wait(signal, std::memory_order_acquire);
+
+            shard.sleeping.store(false, std::memory_order_relaxed);
+        }
+
+        wake_all(); // let the other shards notice that all tasks have completed
+        current_ = ShardContext{};
+    }
+};
+
+#endif
@@ -0,0 +1,244 @@
+#include "async_cache.hpp"
+#include "scheduler.hpp"
+#include "shared_task.hpp"
+#include "task.hpp"
+#include "work_stealing_scheduler.hpp"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    SharedTask<std::string> load_config(Scheduler& scheduler, int& runs)
+    {
+        ++runs;
+        co_await scheduler.fetch_data();
+        co_return "config-v1";
+    }
+
+    SharedTask<int> failing_load(Scheduler& scheduler)
+    {
+        co_await scheduler.fetch_data();
+        throw std::runtime_error{"load failed"};
+    }
+
+    template <typename T>
+    Task<T> await_shared(SharedTask<T> shared)
+    {
+        co_return co_await shared;
+    }
+
+    Task<std::size_t> await_length(SharedTask<std::string> shared, std::vector<int>& order, int id)
+    {
+        const std::string& config = co_await shared;
+        order.push_back(id);
+        co_return config.size();
+    }
+
+    // clock of the TTL tests - moved forward by hand
+    struct ManualClock
+    {
+        using duration = std::chrono::milliseconds;
+        using rep = duration::rep;
+        using period = duration::period;
+        using time_point = std::chrono::time_point<ManualClock>;
+        static constexpr bool is_steady = true;
+
+        inline static time_point current{};
+
+        static time_point now() noexcept
+        {
+            return current;
+        }
+    };
+} // namespace
+
+TEST_CASE("SharedTask - one run, many awaiters", "[coroutines][shared_task]")
+{
+    Scheduler scheduler;
+    int runs = 0;
+
+    auto config = load_config(scheduler, runs);
+    CHECK(runs == 0); // lazily started
+    CHECK_FALSE(config.is_ready());
+
+    std::vector<int> order;
+    std::vector<Task<std::size_t>> consumers;
+    for (int id = 0; id < 10; ++id)
+        consumers.push_back(await_length(config, order, id));
+    for (auto& consumer : consumers)
+        scheduler.submit_task(consumer);
+    scheduler.run();
+
+    CHECK(runs == 1);
+    CHECK(config.is_ready());
+    for (auto& consumer : consumers)
+        CHECK(consumer.result() == "config-v1"s.size());
+    CHECK(order == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}); // resumed in the order of arrival
+
+    SECTION("awaiting a completed task does not run it again")
+    {
+        auto late = await_shared(config);
+        scheduler.submit_task(late);
+        scheduler.run();
+
+        CHECK(late.result() == "config-v1");
+        CHECK(runs == 1);
+    }
+}
+
+TEST_CASE("SharedTask - exception is rethrown to every awaiter", "[coroutines][shared_task]")
+{
+    Scheduler scheduler;
+
+    auto shared = failing_load(scheduler);
+    auto first = await_shared(shared);
+    auto second = await_shared(shared);
+    scheduler.submit_task(first);
+    scheduler.submit_task(second);
+    scheduler.run();
+
+    CHECK(shared.has_failed());
+    CHECK_THROWS_AS(first.result(), std::runtime_error);
+    CHECK_THROWS_AS(second.result(), std::runtime_error);
+}
+
+TEST_CASE("SharedTask - awaiters on many threads", "[coroutines][shared_task]")
+{
+    WorkStealingScheduler scheduler{4};
+    std::atomic<int> runs{0};
+
+    auto compute = [](WorkStealingScheduler& scheduler, std::atomic<int>& runs) -> SharedTask<int> {
+        co_await scheduler.schedule();
+        ++runs;
+        co_return 42;
+    };
+
+    auto shared = compute(scheduler, runs);
+    auto consume = [](WorkStealingScheduler& scheduler, SharedTask<int> shared) -> Task<int> {
+        co_await scheduler.schedule();
+        co_return co_await shared;
+    };
+
+    std::vector<Task<int>> consumers;
+    for (int i = 0; i < 100; ++i)
+        consumers.push_back(consume(scheduler, shared));
+    for (auto& consumer : consumers)
+        scheduler.submit_task(consumer);
+    scheduler.run();
+
+    CHECK(runs == 1);
+    for (auto& consumer : consumers)
+        CHECK(consumer.result() == 42);
+}
+
+TEST_CASE("AsyncCache - in-flight loads are shared", "[coroutines][shared_task][async_cache]")
+{
+    Scheduler scheduler;
+    std::vector<int> loaded_keys;
+
+    AsyncCache<int, std::string> cache{[&](const int& key) -> Task<std::string> {
+        loaded_keys.push_back(key);
+        co_await scheduler.fetch_data();
+        co_return "value-" + std::to_string(key);
+    }, 1min};
+
+    std::vector<Task<std::string>> consumers;
+    for (int key : {1, 2, 1, 1, 2, 3})
+        consumers.push_back(await_shared(cache.get(key)));
+    for (auto& consumer : consumers)
+        scheduler.submit_task(consumer);
+    scheduler.run();
+
+    CHECK(loaded_keys.size() == 3);
+    CHECK(consumers[0].result() == "value-1");
+    CHECK(consumers[3].result() == "value-1");
+    CHECK(consumers[4].result() == "value-2");
+    CHECK(consumers[5].result() == "value-3");
+    CHECK(cache.size() == 3);
+    CHECK(cache.stats().hits == 3);
+    CHECK(cache.stats().misses == 3);
+
+    SECTION("completed values are served from the cache")
+    {
+        auto consumer = await_shared(cache.get(2));
+        scheduler.submit_task(consumer);
+        scheduler.run();
+
+        CHECK(consumer.result() == "value-2");
+        CHECK(loaded_keys.size() == 3);
+    }
+}
+
+TEST_CASE("AsyncCache - TTL eviction and retries", "[coroutines][shared_task][async_cache]")
+{
+    Scheduler scheduler;
+    ManualClock::current = ManualClock::time_point{};
+    int loads = 0;
+    bool fail = false;
+
+    AsyncCache<std::string, int, ManualClock> cache{[&](const std::string& key) -> Task<int> {
+        ++loads;
+        co_await scheduler.fetch_data();
+        if (fail)
+            throw std::runtime_error{"backend down"};
+        co_return static_cast<int>(key.size());
+    }, 100ms};
+
+    auto get = [&](const std::string& key) {
+        auto consumer = await_shared(cache.get(key));
+        scheduler.submit_task(consumer);
+        scheduler.run();
+        return consumer.result();
+    };
+
+    SECTION("expired entries are evicted and loaded again")
+    {
+        CHECK(get("a") == 1);
+        ManualClock::current += 50ms;
+        CHECK(get("bb") == 2);
+        CHECK(get("a") == 1);
+        CHECK(loads == 2);
+
+        ManualClock::current += 60ms; // "a" expired, "bb" has not
+        CHECK(get("bb") == 2);
+        CHECK(cache.size() == 1);
+        CHECK(get("a") == 1);
+        CHECK(loads == 3);
+
+        ManualClock::current += 1h;
+        CHECK(get("ccc") == 3);
+        CHECK(cache.size() == 1); // bounded by the keys requested within the TTL
+        CHECK(cache.stats().evictions == 3);
+    }
+
+    SECTION("entries in flight are not evicted")
+    {
+        auto first = await_shared(cache.get("a"));
+        ManualClock::current += 1h;
+        auto second = await_shared(cache.get("a"));
+        scheduler.submit_task(first);
+        scheduler.submit_task(second);
+        scheduler.run();
+
+        CHECK(first.result() == 1);
+        CHECK(second.result() == 1);
+        CHECK(loads == 1);
+    }
+
+    SECTION("failed loads are not cached")
+    {
+        fail = true;
+        CHECK_THROWS_AS(get("a"), std::runtime_error);
+
+        fail = false;
+        CHECK(get("a") == 1);
+        CHECK(loads == 2);
+    }
+}
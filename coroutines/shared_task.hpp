@@ -0,0 +1,234 @@
+#ifndef SHARED_TASK_HPP
+#define SHARED_TASK_HPP
+
+#include "task.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <variant>
+
+template <typename T = void>
+class SharedTask;
+
+namespace details
+{
+    template <typename T>
+    class SharedTaskResult
+    {
+    public:
+        template <typename TValue = T>
+        void return_value(TValue&& value)
+        {
+            result_.template emplace<1>(std::forward<TValue>(value));
+        }
+
+    protected:
+        std::variant<std::monostate, T, std::exception_ptr> result_;
+
+        const T& value() const
+        {
+            return std::get<1>(result_);
+        }
+    };
+
+    template <>
+    class SharedTaskResult<void>
+    {
+    public:
+        void return_void() noexcept
+        {
+            result_.emplace<1>();
+        }
+
+    protected:
+        std::variant<std::monostate, std::monostate, std::exception_ptr> result_;
+
+        void value() const noexcept { }
+    };
+
+    struct SharedTaskWaiter
+    {
+        std::coroutine_handle<> coro_handle;
+        SharedTaskWaiter* next = nullptr;
+    };
+} // namespace details
+
+// Task awaited by many coroutines - the coroutine runs once, its completion resumes all waiters:
+//  - lazily started by the first co_await (it inherits the scheduling of the first waiter, not its stop token)
+//  - copies share the same coroutine (reference counted); co_await yields const T& valid while a copy is alive
+//  - waiters are kept in a lock-free intrusive list; the completing thread resumes them one after another
+template <typename T>
+class SharedTask
+{
+public:
+    class promise_type : public TaskPromiseBase, public details::SharedTaskResult<T>
+    {
+    public:
+        SharedTask get_return_object()
+        {
+            return SharedTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<promise_type> coro_handle) noexcept
+            {
+                promise_type& promise = coro_handle.promise();
+                promise.ref_count_.fetch_add(1, std::memory_order_relaxed); // a resumed waiter may drop the last copy
+
+                auto* stack = static_cast<details::SharedTaskWaiter*>(promise.waiters_.exchange(promise.completed(), std::memory_order_acq_rel));
+                details::SharedTaskWaiter* waiter = nullptr;
+                while (stack) // waiters are resumed in the order they arrived
+                    waiter = std::exchange(stack, std::exchange(stack->next, waiter));
+
+                while (waiter)
+                {
+                    details::SharedTaskWaiter* next = waiter->next; // the waiter is gone once its coroutine runs
+                    waiter->coro_handle.resume();
+                    waiter = next;
+                }
+
+                if (promise.ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    coro_handle.destroy();
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void unhandled_exception() noexcept
+        {
+            this->result_.template emplace<2>(std::current_exception());
+        }
+
+    private:
+        friend class SharedTask;
+
+        std::atomic<std::size_t> ref_count_{1};
+        std::atomic<bool> started_{false};
+        std::atomic<void*> waiters_{nullptr}; // stack of waiters or completed()
+
+        void* completed() noexcept
+        {
+            return this;
+        }
+
+        bool is_completed() noexcept
+        {
+            return waiters_.load(std::memory_order_acquire) == completed();
+        }
+
+        // false - the task has already completed
+        bool push_waiter(details::SharedTaskWaiter& waiter) noexcept
+        {
+            void* state = waiters_.load(std::memory_order_acquire);
+            do
+            {
+                if (state == completed())
+                    return false;
+                waiter.next = static_cast<details::SharedTaskWaiter*>(state);
+            } while (!waiters_.compare_exchange_weak(state, &waiter, std::memory_order_acq_rel, std::memory_order_acquire));
+
+            return true;
+        }
+
+        decltype(auto) result() const
+        {
+            if (this->result_.index() == 2)
+                std::rethrow_exception(std::get<2>(this->result_));
+            return this->value();
+        }
+    };
+
+    SharedTask() = default;
+
+    SharedTask(const SharedTask& other) noexcept
+        : coro_handle_{other.coro_handle_}
+    {
+        if (coro_handle_)
+            coro_handle_.promise().ref_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    SharedTask(SharedTask&& other) noexcept
+        : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+    { }
+
+    SharedTask& operator=(SharedTask other) noexcept
+    {
+        std::swap(coro_handle_, other.coro_handle_);
+        return *this;
+    }
+
+    ~SharedTask()
+    {
+        if (coro_handle_ && coro_handle_.promise().ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            coro_handle_.destroy();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool>(coro_handle_);
+    }
+
+    bool is_ready() const noexcept
+    {
+        return coro_handle_ && coro_handle_.promise().is_completed();
+    }
+
+    // completed with an exception
+    bool has_failed() const noexcept
+    {
+        return is_ready() && coro_handle_.promise().result_.index() == 2;
+    }
+
+    auto operator co_await() const noexcept
+    {
+        return Awaiter{{}, coro_handle_};
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_handle_ = nullptr;
+
+    struct Awaiter : details::SharedTaskWaiter
+    {
+        std::coroutine_handle<promise_type> shared_coro;
+
+        bool await_ready() const noexcept
+        {
+            return shared_coro.promise().is_completed();
+        }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            this->coro_handle = awaiting_coro;
+
+            promise_type& promise = shared_coro.promise();
+            if (!promise.push_waiter(*this))
+                return awaiting_coro; // completed in the meantime
+
+            if (promise.started_.exchange(true, std::memory_order_acq_rel))
+                return std::noop_coroutine();
+
+            promise.scheduling = scheduling_of(awaiting_coro);
+            return shared_coro; // the first waiter starts the task
+        }
+
+        decltype(auto) await_resume() const
+        {
+            return shared_coro.promise().result();
+        }
+    };
+
+    explicit SharedTask(std::coroutine_handle<promise_type> coro_handle)
+        : coro_handle_{coro_handle}
+    { }
+};
+
+#endif
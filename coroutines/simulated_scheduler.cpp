@@ -0,0 +1,144 @@
+#include "async_primitives.hpp"
+#include "simulated_scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    template <typename TScheduler>
+    Task<> client(TScheduler& scheduler, int request_count, LatencyRecorder& latencies, std::vector<int>& values)
+    {
+        for (int i = 0; i < request_count; ++i)
+        {
+            const auto start = scheduler.now();
+            values.push_back(co_await scheduler.fetch_data());
+            latencies.record(scheduler.now() - start);
+        }
+    }
+
+    struct SimulationResult
+    {
+        LatencyRecorder latencies;
+        std::vector<int> values;
+        VirtualClock::duration elapsed{};
+    };
+
+    SimulationResult simulate(SimulationConfig config, int client_count = 10, int request_count = 100)
+    {
+        SimulatedScheduler scheduler{config};
+        SimulationResult result;
+
+        std::vector<Task<>> clients;
+        for (int i = 0; i < client_count; ++i)
+            clients.push_back(client(scheduler, request_count, result.latencies, result.values));
+        for (auto& task : clients)
+            scheduler.submit_task(task);
+
+        const auto start = scheduler.now();
+        scheduler.run();
+        result.elapsed = scheduler.now() - start;
+
+        return result;
+    }
+} // namespace
+
+TEST_CASE("SimulatedScheduler - virtual time", "[coroutines][simulation]")
+{
+    SimulatedScheduler scheduler;
+
+    auto sleeper = [](SimulatedScheduler& scheduler) -> Task<VirtualClock::duration> {
+        const auto start = scheduler.now();
+        co_await scheduler.sleep_for(1h);
+        co_await scheduler.sleep_for(30min);
+        co_return scheduler.now() - start;
+    }(scheduler);
+
+    const auto wall_start = std::chrono::steady_clock::now();
+    scheduler.submit_task(sleeper);
+    scheduler.run();
+
+    CHECK(sleeper.result() == 90min);
+    CHECK(std::chrono::steady_clock::now() - wall_start < 1s);
+}
+
+TEST_CASE("SimulatedScheduler - runs are repeatable", "[coroutines][simulation]")
+{
+    const SimulationConfig config{.seed = 42,
+        .fetch_latency = LatencyDistribution::exponential(100us, 2ms),
+        .timer_latency = LatencyDistribution::uniform(0us, 50us),
+        .resume_cost = 1us};
+
+    SimulationResult first = simulate(config);
+    SimulationResult second = simulate(config);
+
+    CHECK(first.values == second.values);
+    CHECK(first.latencies.samples() == second.latencies.samples());
+    CHECK(first.elapsed == second.elapsed);
+
+    SimulationResult other_seed = simulate(SimulationConfig{.seed = 7, .fetch_latency = config.fetch_latency});
+    CHECK(first.latencies.samples() != other_seed.latencies.samples());
+}
+
+TEST_CASE("SimulatedScheduler - throughput and tail latency", "[coroutines][simulation]")
+{
+    SECTION("uniform latency")
+    {
+        SimulationResult result = simulate(SimulationConfig{.seed = 1, .fetch_latency = LatencyDistribution::uniform(1ms, 3ms)});
+
+        REQUIRE(result.latencies.count() == 1000);
+        CHECK(result.latencies.percentile(0) >= 1ms);
+        CHECK(result.latencies.max() <= 3ms);
+        CHECK(result.latencies.percentile(50) > 1500us);
+        CHECK(result.latencies.percentile(50) < 2500us);
+
+        // 10 clients, 100 sequential requests of ~2ms each
+        const double throughput = 1000.0 / std::chrono::duration<double>(result.elapsed).count();
+        CHECK(throughput > 4000.0);
+        CHECK(throughput < 6000.0);
+    }
+
+    SECTION("long tail")
+    {
+        SimulationResult result = simulate(SimulationConfig{.seed = 1, .fetch_latency = LatencyDistribution::exponential(0ms, 1ms)});
+
+        CHECK(result.latencies.percentile(99) > 3 * result.latencies.percentile(50));
+    }
+
+    SECTION("resume cost serializes the clients")
+    {
+        SimulationResult result = simulate(SimulationConfig{.fetch_latency = LatencyDistribution::constant(0ms), .resume_cost = 10us});
+
+        // 10 clients x (100 requests + start) resumptions of 10us each
+        CHECK(result.elapsed == 10 * 101 * 10us);
+    }
+}
+
+TEST_CASE("SimulatedScheduler - synchronization primitives", "[coroutines][simulation]")
+{
+    SimulatedScheduler scheduler{SimulationConfig{.fetch_latency = LatencyDistribution::constant(1ms)}};
+    AsyncMutex mutex{scheduler};
+    int value = 0;
+
+    auto worker = [](SimulatedScheduler& scheduler, AsyncMutex& mutex, int& value) -> Task<> {
+        std::unique_lock lk = co_await mutex.scoped_lock();
+        const int read = value;
+        co_await scheduler.fetch_data();
+        value = read + 1;
+    };
+
+    std::vector<Task<>> workers;
+    for (int i = 0; i < 5; ++i)
+        workers.push_back(worker(scheduler, mutex, value));
+    for (auto& task : workers)
+        scheduler.submit_task(task);
+    scheduler.run();
+
+    CHECK(value == 5);
+    CHECK(scheduler.now() - VirtualClock::time_point{} == 5ms); // the critical sections ran one after another
+}
@@ -0,0 +1,338 @@
+#ifndef SIMULATED_SCHEDULER_HPP
+#define SIMULATED_SCHEDULER_HPP
+
+#include "ready_queue.hpp"
+#include "task.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random.hpp>
+#include <utility>
+#include <vector>
+
+// time of a SimulatedScheduler - advances only when the scheduler jumps to the next event
+struct VirtualClock
+{
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<VirtualClock, duration>;
+    static constexpr bool is_steady = true;
+};
+
+// Latency of a simulated operation - a pure function of the generator state
+// (std:: distributions are not used - their results differ between standard library implementations)
+class LatencyDistribution
+{
+public:
+    using Duration = VirtualClock::duration;
+
+    static LatencyDistribution constant(Duration latency)
+    {
+        return LatencyDistribution{Kind::constant, latency, latency};
+    }
+
+    static LatencyDistribution uniform(Duration min, Duration max)
+    {
+        return LatencyDistribution{Kind::uniform, min, std::max(min, max)};
+    }
+
+    // min + exponentially distributed part with the given mean - a long tail
+    static LatencyDistribution exponential(Duration min, Duration mean)
+    {
+        return LatencyDistribution{Kind::exponential, min, std::max(min, mean)};
+    }
+
+    Duration operator()(helpers::random::PCG& rng) const
+    {
+        switch (kind_)
+        {
+        case Kind::uniform:
+        {
+            const auto range = static_cast<std::uint64_t>((b_ - a_).count()) + 1;
+            const std::uint64_t high = rng(); // sequenced - the order of the calls in one expression is unspecified
+            const std::uint64_t low = rng();
+            const std::uint64_t bits = (high << 32) | low;
+            return a_ + Duration{static_cast<Duration::rep>(bits % range)};
+        }
+        case Kind::exponential:
+        {
+            // inverse CDF: -ln(u) * mean for u in (0, 1] - in fixed point, libm results may differ between platforms
+            const std::uint64_t neg_ln_u = neg_ln_q24(std::uint64_t{rng()} + 1);
+            const auto mean = static_cast<std::uint64_t>((b_ - a_).count());
+            return a_ + Duration{static_cast<Duration::rep>((neg_ln_u >> 24) * mean + (((neg_ln_u & 0xFF'FFFF) * mean) >> 24))};
+        }
+        default:
+            return a_;
+        }
+    }
+
+private:
+    // -ln(x / 2^32) for x in [1, 2^32] with 24 fractional bits - log2 bit by bit (by squaring the mantissa),
+    // integer arithmetic only
+    static std::uint64_t neg_ln_q24(std::uint64_t x) noexcept
+    {
+        constexpr int fraction_bits = 24;
+        constexpr std::uint64_t ln2_q30 = 744'261'118; // ln(2) * 2^30
+        constexpr std::uint64_t one_q31 = std::uint64_t{1} << 31;
+
+        const int exponent = std::bit_width(x) - 1; // integer part of log2(x)
+        std::uint64_t mantissa = exponent >= 31 ? x >> (exponent - 31) : x << (31 - exponent); // x / 2^exponent in [1, 2), Q31
+        std::uint64_t log2_x = static_cast<std::uint64_t>(exponent) << fraction_bits;
+        for (int bit = fraction_bits - 1; bit >= 0; --bit)
+        {
+            mantissa = (mantissa * mantissa) >> 31;
+            if (mantissa >= 2 * one_q31)
+            {
+                mantissa >>= 1;
+                log2_x |= std::uint64_t{1} << bit;
+            }
+        }
+
+        const std::uint64_t neg_log2 = (std::uint64_t{32} << fraction_bits) - log2_x;
+        return (neg_log2 * ln2_q30) >> 30;
+    }
+
+    enum class Kind
+    {
+        constant,
+        uniform,
+        exponential
+    };
+
+    Kind kind_;
+    Duration a_;
+    Duration b_;
+
+    LatencyDistribution(Kind kind, Duration a, Duration b)
+        : kind_{kind}
+        , a_{a}
+        , b_{b}
+    { }
+};
+
+struct SimulationConfig
+{
+    std::uint64_t seed = 0;
+    LatencyDistribution fetch_latency = LatencyDistribution::constant(std::chrono::milliseconds{1});
+    LatencyDistribution timer_latency = LatencyDistribution::constant(VirtualClock::duration::zero()); // added to every timer
+    VirtualClock::duration resume_cost{}; // virtual time consumed by every resumption (CPU work of a step)
+    SchedulingPolicy scheduling_policy{};
+};
+
+// Latencies recorded by a simulated workload
+class LatencyRecorder
+{
+public:
+    using Duration = VirtualClock::duration;
+
+    void record(Duration latency)
+    {
+        samples_.push_back(latency);
+        sorted_ = false;
+    }
+
+    std::size_t count() const
+    {
+        return samples_.size();
+    }
+
+    // nearest-rank percentile (p in [0, 100]); precondition: count() > 0
+    Duration percentile(double p)
+    {
+        sort();
+        const auto rank = static_cast<std::size_t>(std::ceil(p / 100.0 * static_cast<double>(samples_.size())));
+        return samples_[std::clamp<std::size_t>(rank, 1, samples_.size()) - 1];
+    }
+
+    Duration max()
+    {
+        sort();
+        return samples_.back();
+    }
+
+    const std::vector<Duration>& samples() const
+    {
+        return samples_;
+    }
+
+private:
+    std::vector<Duration> samples_;
+    bool sorted_ = true;
+
+    void sort()
+    {
+        if (!sorted_)
+            std::ranges::sort(samples_);
+        sorted_ = true;
+    }
+};
+
+// Scheduler running on virtual time - for reproducible performance experiments:
+//  - fetch_data() and timers complete after latencies drawn from seeded distributions (helpers::random::PCG),
+//    fetched values come from the same generator
+//  - run() resumes ready coroutines (ReadyQueue - priorities as in Scheduler), then jumps to the next event;
+//    nothing waits for real time, so an hour of simulated traffic takes milliseconds
+//  - single threaded and free of wall-clock reads - runs with the same seed are bit-for-bit identical
+//  - workloads are written against the scheduler type (template <typename TScheduler>)
+class SimulatedScheduler
+{
+public:
+    using Clock = VirtualClock;
+
+    explicit SimulatedScheduler(SimulationConfig config = {})
+        : config_{config}
+        , rng_{config.seed}
+        , ready_coroutines_{config.scheduling_policy}
+    { }
+
+    SimulatedScheduler(const SimulatedScheduler&) = delete;
+    SimulatedScheduler& operator=(const SimulatedScheduler&) = delete;
+
+    // must be called on the thread running the simulation
+    void submit_coro(std::coroutine_handle<> coro_handle, TaskScheduling scheduling = {})
+    {
+        ready_coroutines_.push(coro_handle, scheduling);
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task, TaskScheduling scheduling = {})
+    {
+        auto coro_handle = task.get_coro_handle();
+        coro_handle.promise().scheduling = scheduling;
+        submit_coro(coro_handle, scheduling);
+    }
+
+    Clock::time_point now() const
+    {
+        return now_;
+    }
+
+    // co_await scheduler.fetch_data() - completes after config.fetch_latency
+    auto fetch_data()
+    {
+        return FetchAwaiter{*this};
+    }
+
+    // co_await scheduler.sleep_until(deadline) - completes config.timer_latency after the deadline
+    auto sleep_until(Clock::time_point deadline)
+    {
+        return SleepAwaiter{*this, deadline};
+    }
+
+    auto sleep_for(Clock::duration duration)
+    {
+        return sleep_until(now_ + duration);
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            release_due_events();
+
+            if (!ready_coroutines_.empty())
+            {
+                ready_coroutines_.pop().resume();
+                ++resume_count_;
+                now_ += config_.resume_cost;
+                continue;
+            }
+
+            if (events_.empty())
+                break;
+
+            now_ = events_.top().time;
+        }
+    }
+
+    std::size_t resume_count() const
+    {
+        return resume_count_;
+    }
+
+private:
+    struct Event
+    {
+        Clock::time_point time;
+        std::uint64_t sequence; // events due at the same time complete in the order of scheduling
+        std::coroutine_handle<> coro_handle;
+        TaskScheduling scheduling;
+
+        bool operator>(const Event& other) const
+        {
+            return time != other.time ? time > other.time : sequence > other.sequence;
+        }
+    };
+
+    struct FetchAwaiter
+    {
+        SimulatedScheduler& scheduler;
+        int value = 0;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            value = scheduler.next_value();
+            scheduler.schedule_event(scheduler.now_ + scheduler.config_.fetch_latency(scheduler.rng_), awaiting_coro,
+                scheduling_of(awaiting_coro));
+        }
+
+        int await_resume() const noexcept { return value; }
+    };
+
+    struct SleepAwaiter
+    {
+        SimulatedScheduler& scheduler;
+        Clock::time_point deadline;
+
+        bool await_ready() const noexcept { return false; }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            const auto time = std::max(deadline, scheduler.now_) + scheduler.config_.timer_latency(scheduler.rng_);
+            scheduler.schedule_event(time, awaiting_coro, scheduling_of(awaiting_coro));
+        }
+
+        void await_resume() const noexcept { }
+    };
+
+    SimulationConfig config_;
+    helpers::random::PCG rng_;
+    Clock::time_point now_{};
+    ReadyQueue ready_coroutines_;
+    std::priority_queue<Event, std::vector<Event>, std::greater<>> events_;
+    std::uint64_t next_sequence_ = 0;
+    std::size_t resume_count_ = 0;
+
+    void schedule_event(Clock::time_point time, std::coroutine_handle<> coro_handle, TaskScheduling scheduling)
+    {
+        events_.push(Event{time, next_sequence_++, coro_handle, scheduling});
+    }
+
+    void release_due_events()
+    {
+        while (!events_.empty() && events_.top().time <= now_)
+        {
+            ready_coroutines_.push(events_.top().coro_handle, events_.top().scheduling);
+            events_.pop();
+        }
+    }
+
+    int next_value()
+    {
+        return static_cast<int>(rng_() % 100) + 1;
+    }
+};
+
+#endif
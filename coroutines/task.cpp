@@ -0,0 +1,141 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace std::literals;
+
+namespace
+{
+    Task<int> fetch_and_double(Scheduler& scheduler)
+    {
+        int value = co_await scheduler.fetch_data();
+        co_return 2 * value;
+    }
+
+    Task<std::string> describe(Scheduler& scheduler)
+    {
+        int first = co_await fetch_and_double(scheduler);
+        int second = co_await fetch_and_double(scheduler);
+
+        co_return std::to_string(first) + "+"s + std::to_string(second);
+    }
+
+    Task<> pipeline(Scheduler& scheduler, std::string& result)
+    {
+        result = co_await describe(scheduler);
+    }
+
+    Task<int> immediate_value(int value)
+    {
+        co_return value;
+    }
+
+    Task<long> sum_of_immediate_values(int count)
+    {
+        long sum = 0;
+        for (int i = 0; i < count; ++i)
+            sum += co_await immediate_value(i); // every step completes synchronously
+        co_return sum;
+    }
+
+    Task<int> nested_depth(int depth)
+    {
+        if (depth == 0)
+            co_return 0;
+        co_return 1 + co_await nested_depth(depth - 1);
+    }
+
+    Task<int> throwing_step()
+    {
+        throw std::runtime_error{"step failed"};
+        co_return 0;
+    }
+
+    Task<std::unique_ptr<int>> move_only_value()
+    {
+        co_return std::make_unique<int>(665);
+    }
+} // namespace
+
+TEST_CASE("Task<T> - awaiting returns the value", "[coroutines][task]")
+{
+    Scheduler scheduler;
+    std::string result;
+
+    Task<> task = pipeline(scheduler, result);
+    scheduler.submit_task(task);
+    scheduler.run();
+
+    CHECK(result.find('+') != std::string::npos);
+    CHECK(scheduler.resume_count() == 3); // start + 2 x fetch_data - awaiting child tasks costs no queue round-trip
+}
+
+TEST_CASE("Task<T> - result of a top-level task", "[coroutines][task]")
+{
+    Scheduler scheduler;
+
+    Task<int> task = fetch_and_double(scheduler);
+    scheduler.submit_task(task);
+    scheduler.run();
+
+    REQUIRE(task.is_ready());
+    CHECK(task.result() % 2 == 0);
+}
+
+TEST_CASE("Task<T> - symmetric transfer keeps the stack flat", "[coroutines][task]")
+{
+    SECTION("long chain of synchronously completing awaits")
+    {
+        Task<long> task = sum_of_immediate_values(1'000'000);
+        task.get_coro_handle().resume();
+
+        REQUIRE(task.is_ready());
+        CHECK(task.result() == 499'999'500'000L);
+    }
+
+    SECTION("deep recursion")
+    {
+        Task<int> task = nested_depth(10'000);
+        task.get_coro_handle().resume();
+
+        REQUIRE(task.is_ready());
+        CHECK(task.result() == 10'000);
+    }
+}
+
+TEST_CASE("Task<T> - exceptions are propagated to the awaiter", "[coroutines][task]")
+{
+    auto awaiting = []() -> Task<std::string> {
+        try
+        {
+            co_await throwing_step();
+        }
+        catch (const std::runtime_error& e)
+        {
+            co_return e.what();
+        }
+        co_return "no exception";
+    };
+
+    Task<std::string> task = awaiting();
+    task.get_coro_handle().resume();
+
+    CHECK(task.result() == "step failed");
+}
+
+TEST_CASE("Task<T> - move only values", "[coroutines][task]")
+{
+    auto consumer = []() -> Task<int> {
+        std::unique_ptr<int> ptr = co_await move_only_value();
+        co_return *ptr;
+    };
+
+    Task<int> task = consumer();
+    task.get_coro_handle().resume();
+
+    CHECK(task.result() == 665);
+}
@@ -0,0 +1,343 @@
+#ifndef TASK_HPP
+#define TASK_HPP
+
+#include "frame_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <stop_token>
+#include <utility>
+#include <variant>
+
+// thrown from co_await of a cancellable awaiter when the stop token of the awaiting task is triggered
+class OperationCancelled : public std::exception
+{
+public:
+    const char* what() const noexcept override
+    {
+        return "operation cancelled";
+    }
+};
+
+// priority band of a task - schedulers resume ready tasks of higher bands first
+enum class TaskPriority : std::uint8_t
+{
+    critical,
+    high,
+    normal,
+    low,
+    background
+};
+
+inline constexpr std::size_t task_priority_count = 5;
+
+// how a scheduler orders a ready task - inherited by the tasks it co_awaits
+struct TaskScheduling
+{
+    TaskPriority priority = TaskPriority::normal;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max(); // earliest-deadline-first mode
+};
+
+template <typename T = void>
+class Task;
+
+class TaskPromiseBase;
+
+// stop token of a coroutine (an empty token for coroutines that are not tasks)
+template <typename TPromise>
+std::stop_token stop_token_of(std::coroutine_handle<TPromise> coro_handle) noexcept
+{
+    if constexpr (std::derived_from<TPromise, TaskPromiseBase>)
+        return coro_handle.promise().stop_token;
+    else
+        return {};
+}
+
+// scheduling of a coroutine (the default one for coroutines that are not tasks)
+template <typename TPromise>
+TaskScheduling scheduling_of(std::coroutine_handle<TPromise> coro_handle) noexcept
+{
+    if constexpr (std::derived_from<TPromise, TaskPromiseBase>)
+        return coro_handle.promise().scheduling;
+    else
+        return {};
+}
+
+class TaskPromiseBase : public PooledFrameAllocation
+{
+public:
+    // set by schedulers that need to know when a submitted task has finished
+    std::atomic<std::size_t>* pending_tasks_counter = nullptr;
+
+    // coroutine awaiting this task - resumed from final_suspend()
+    std::coroutine_handle<> continuation = nullptr;
+
+    // cancellation request for the task - inherited by the tasks it co_awaits (unless they have their own)
+    std::stop_token stop_token;
+
+    // priority and deadline - inherited by the tasks it co_awaits
+    TaskScheduling scheduling;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // called when the coroutine is resumed on behalf of awaiting_coro
+    template <typename TPromise>
+    void inherit_from(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+    {
+        if (!stop_token.stop_possible())
+            stop_token = stop_token_of(awaiting_coro);
+        if constexpr (std::derived_from<TPromise, TaskPromiseBase>)
+            scheduling = awaiting_coro.promise().scheduling;
+    }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept { return false; }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> coro_handle) noexcept
+        {
+            TaskPromiseBase& promise = coro_handle.promise();
+
+            // symmetric transfer - the awaiting coroutine is resumed without growing the stack
+            if (promise.continuation)
+                return promise.continuation;
+
+            if (auto* counter = promise.pending_tasks_counter)
+            {
+                if (counter->fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    counter->notify_all();
+            }
+
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept { }
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object();
+
+    template <typename TValue = T>
+    void return_value(TValue&& value)
+    {
+        result_.template emplace<1>(std::forward<TValue>(value));
+    }
+
+    void unhandled_exception() noexcept
+    {
+        result_.template emplace<2>(std::current_exception());
+    }
+
+    T& result() &
+    {
+        rethrow_if_exception();
+        return std::get<1>(result_);
+    }
+
+    T&& result() &&
+    {
+        rethrow_if_exception();
+        return std::get<1>(std::move(result_));
+    }
+
+private:
+    std::variant<std::monostate, T, std::exception_ptr> result_;
+
+    void rethrow_if_exception()
+    {
+        if (result_.index() == 2)
+            std::rethrow_exception(std::get<2>(result_));
+    }
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object();
+
+    void return_void() noexcept { }
+
+    void unhandled_exception() noexcept
+    {
+        exception_ = std::current_exception();
+    }
+
+    void result()
+    {
+        if (exception_)
+            std::rethrow_exception(exception_);
+    }
+
+private:
+    std::exception_ptr exception_;
+};
+
+// Lazily started coroutine - starts when it is submitted to a scheduler or co_awaited by another coroutine.
+// co_await task - resumes the task by symmetric transfer and returns its value (or rethrows its exception)
+template <typename T>
+class Task
+{
+public:
+    using promise_type = TaskPromise<T>;
+
+    Task(std::coroutine_handle<promise_type> coro_handle)
+        : coro_handle_{coro_handle}
+    { }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    Task(Task&& other) noexcept
+        : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+    { }
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (coro_handle_)
+                coro_handle_.destroy();
+            coro_handle_ = std::exchange(other.coro_handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (coro_handle_)
+            coro_handle_.destroy();
+    }
+
+    auto get_coro_handle() const
+    {
+        return coro_handle_;
+    }
+
+    bool is_ready() const
+    {
+        return !coro_handle_ || coro_handle_.done();
+    }
+
+    // value of a completed task
+    decltype(auto) result() &
+    {
+        return coro_handle_.promise().result();
+    }
+
+    decltype(auto) result() &&
+    {
+        return std::move(coro_handle_.promise()).result();
+    }
+
+    auto operator co_await() & noexcept
+    {
+        struct TaskAwaiter : AwaiterBase
+        {
+            decltype(auto) await_resume()
+            {
+                return this->coro_handle.promise().result();
+            }
+        };
+
+        return TaskAwaiter{{coro_handle_}};
+    }
+
+    auto operator co_await() && noexcept
+    {
+        struct TaskAwaiter : AwaiterBase
+        {
+            decltype(auto) await_resume()
+            {
+                return std::move(this->coro_handle.promise()).result();
+            }
+        };
+
+        return TaskAwaiter{{coro_handle_}};
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro_handle_;
+
+    struct AwaiterBase
+    {
+        std::coroutine_handle<promise_type> coro_handle;
+
+        bool await_ready() const noexcept
+        {
+            return !coro_handle || coro_handle.done();
+        }
+
+        template <typename TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+        {
+            auto& promise = coro_handle.promise();
+            promise.continuation = awaiting_coro;
+            promise.inherit_from(awaiting_coro);
+            return coro_handle;
+        }
+    };
+};
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+struct StopTokenAwaiter
+{
+    std::stop_token stop_token;
+
+    bool await_ready() const noexcept { return false; }
+
+    template <typename TPromise>
+    bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro) noexcept
+    {
+        stop_token = stop_token_of(awaiting_coro);
+        return false; // no suspension
+    }
+
+    std::stop_token await_resume() noexcept { return std::move(stop_token); }
+};
+
+// co_await get_stop_token() - stop token of the current task
+inline StopTokenAwaiter get_stop_token() noexcept
+{
+    return {};
+}
+
+// awaiter obtained by co_await for an awaitable (member or free operator co_await or the awaitable itself)
+template <typename TAwaitable>
+decltype(auto) get_awaiter(TAwaitable&& awaitable)
+{
+    if constexpr (requires { std::forward<TAwaitable>(awaitable).operator co_await(); })
+        return std::forward<TAwaitable>(awaitable).operator co_await();
+    else if constexpr (requires { operator co_await(std::forward<TAwaitable>(awaitable)); })
+        return operator co_await(std::forward<TAwaitable>(awaitable));
+    else
+        return std::forward<TAwaitable>(awaitable);
+}
+
+// type of the co_await expression
+template <typename TAwaitable>
+using await_result_t = decltype(get_awaiter(std::declval<TAwaitable>()).await_resume());
+
+#endif
@@ -0,0 +1,233 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct RecordingTimer : TimerNode
+    {
+        std::vector<std::uint64_t>* fired;
+
+        explicit RecordingTimer(std::vector<std::uint64_t>& log)
+            : fired{&log}
+        {
+            context = this;
+            on_expired = [](TimerNode& node) {
+                auto& self = *static_cast<RecordingTimer*>(node.context);
+                self.fired->push_back(self.expiry_tick);
+            };
+        }
+    };
+} // namespace
+
+TEST_CASE("TimerWheel", "[coroutines][timers]")
+{
+    TimerWheel wheel;
+    std::vector<std::uint64_t> fired;
+
+    SECTION("timers fire in expiry order exactly at their tick")
+    {
+        std::list<RecordingTimer> timers;
+        const std::vector<std::uint64_t> expiries = {5, 1, 63, 64, 65, 4095, 4096, 300'000, 70, 1};
+        for (auto expiry : expiries)
+            wheel.schedule(timers.emplace_back(fired), expiry);
+
+        CHECK(wheel.size() == expiries.size());
+
+        wheel.advance(64);
+        CHECK(fired == std::vector<std::uint64_t>{1, 1, 5, 63, 64});
+
+        fired.clear();
+        wheel.advance(300'000);
+        CHECK(fired == std::vector<std::uint64_t>{65, 70, 4095, 4096, 300'000});
+        CHECK(wheel.empty());
+    }
+
+    SECTION("next_expiry")
+    {
+        CHECK_FALSE(wheel.next_expiry().has_value());
+
+        RecordingTimer near{fired};
+        RecordingTimer far{fired};
+        wheel.schedule(far, 10'000);
+        CHECK(wheel.next_expiry() == 8192u); // cascade point of a level 2 slot
+
+        wheel.schedule(near, 42);
+        CHECK(wheel.next_expiry() == 42u);
+
+        wheel.advance(42);
+        CHECK(wheel.next_expiry() == 8192u);
+
+        wheel.advance(8192);
+        CHECK(wheel.next_expiry() == 9984u); // cascaded to level 1
+
+        wheel.advance(9984);
+        CHECK(wheel.next_expiry() == 10'000u); // level 0 - exact expiry
+        CHECK(fired == std::vector<std::uint64_t>{42});
+    }
+
+    SECTION("cancelled timers do not fire")
+    {
+        RecordingTimer first{fired};
+        RecordingTimer second{fired};
+        wheel.schedule(first, 100);
+        wheel.schedule(second, 100);
+
+        wheel.advance(80); // the slot is cascaded before cancel
+        wheel.cancel(first);
+
+        {
+            RecordingTimer destroyed{fired};
+            wheel.schedule(destroyed, 90);
+        }
+
+        wheel.advance(1000);
+        CHECK(fired == std::vector<std::uint64_t>{100});
+        CHECK(wheel.empty());
+    }
+
+    SECTION("timers in the past fire on the next tick")
+    {
+        wheel.advance(1000);
+        RecordingTimer timer{fired};
+        wheel.schedule(timer, 10);
+
+        wheel.advance(1001);
+        CHECK(fired == std::vector<std::uint64_t>{1001});
+    }
+
+    SECTION("many timers")
+    {
+        constexpr std::uint64_t count = 100'000;
+        std::list<RecordingTimer> timers;
+        for (std::uint64_t i = 0; i < count; ++i)
+            wheel.schedule(timers.emplace_back(fired), 1 + (i * 7919) % 1'000'000);
+
+        bool cancel = true;
+        for (auto& timer : timers)
+        {
+            if (cancel)
+                wheel.cancel(timer);
+            cancel = !cancel;
+        }
+
+        wheel.advance(1'000'000);
+        CHECK(fired.size() == count / 2);
+        CHECK(std::ranges::is_sorted(fired));
+    }
+}
+
+namespace
+{
+    Task<> sleeper(Scheduler& scheduler, std::chrono::milliseconds duration, std::vector<int>& wake_order, int id)
+    {
+        co_await scheduler.sleep_for(duration);
+        wake_order.push_back(id);
+    }
+
+    Task<int> delayed_value(Scheduler& scheduler, std::chrono::milliseconds delay, int value)
+    {
+        co_await scheduler.sleep_for(delay);
+        co_return value;
+    }
+
+    Task<int> delayed_error(Scheduler& scheduler, std::chrono::milliseconds delay)
+    {
+        co_await scheduler.sleep_for(delay);
+        throw std::runtime_error{"error"};
+    }
+} // namespace
+
+TEST_CASE("sleep_for", "[coroutines][timers]")
+{
+    Scheduler scheduler;
+    std::vector<int> wake_order;
+
+    std::vector<Task<>> tasks;
+    tasks.push_back(sleeper(scheduler, 30ms, wake_order, 3));
+    tasks.push_back(sleeper(scheduler, 10ms, wake_order, 1));
+    tasks.push_back(sleeper(scheduler, 20ms, wake_order, 2));
+    tasks.push_back(sleeper(scheduler, 0ms, wake_order, 0));
+
+    for (auto& task : tasks)
+        scheduler.submit_task(task);
+
+    const auto start = std::chrono::steady_clock::now();
+    scheduler.run();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK(wake_order == std::vector{0, 1, 2, 3});
+    CHECK(elapsed >= 30ms);
+    CHECK(scheduler.pending_timers() == 0);
+    CHECK(scheduler.resume_count() <= 8); // run() sleeps until the next expiry instead of polling
+}
+
+TEST_CASE("with_timeout", "[coroutines][timers]")
+{
+    Scheduler scheduler;
+
+    SECTION("result before the deadline")
+    {
+        auto task = [](Scheduler& scheduler) -> Task<std::optional<int>> {
+            co_return co_await with_timeout(delayed_value(scheduler, 5ms, 42), 1s);
+        }(scheduler);
+
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == 42);
+    }
+
+    SECTION("timeout")
+    {
+        auto task = [](Scheduler& scheduler) -> Task<std::optional<int>> {
+            co_return co_await with_timeout(delayed_value(scheduler, 1s, 42), 10ms);
+        }(scheduler);
+
+        const auto start = std::chrono::steady_clock::now();
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == std::nullopt);
+        CHECK(std::chrono::steady_clock::now() - start < 1s);
+        CHECK(scheduler.pending_timers() == 0); // the awaitable has been cancelled
+    }
+
+    SECTION("void awaitable")
+    {
+        auto task = [](Scheduler& scheduler) -> Task<std::pair<bool, bool>> {
+            const bool completed = co_await with_timeout(scheduler.sleep_for(1ms), 1s);
+            const bool timed_out = !co_await with_timeout(scheduler.sleep_for(1s), 1ms);
+            co_return std::pair{completed, timed_out};
+        }(scheduler);
+
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK(task.result() == std::pair{true, true});
+    }
+
+    SECTION("exception is propagated")
+    {
+        auto task = [](Scheduler& scheduler) -> Task<std::optional<int>> {
+            co_return co_await with_timeout(delayed_error(scheduler, 1ms), 1s);
+        }(scheduler);
+
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK_THROWS_AS(task.result(), std::runtime_error);
+    }
+}
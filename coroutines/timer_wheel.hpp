@@ -0,0 +1,264 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+class TimerWheel;
+
+// Intrusive timer - lives in the awaiter that waits for it, so arming a timer does not allocate
+struct TimerNode
+{
+    using Callback = void (*)(TimerNode& timer);
+
+    Callback on_expired = nullptr;
+    void* context = nullptr;
+
+    std::uint64_t expiry_tick = 0;
+    TimerNode* prev = nullptr;
+    TimerNode* next = nullptr;
+    TimerWheel* wheel = nullptr; // set while the timer is armed
+
+    TimerNode() = default;
+    TimerNode(Callback callback, void* ctx)
+        : on_expired{callback}
+        , context{ctx}
+    { }
+
+    // a copy gets the callback but is never armed (so awaiters holding a timer stay copyable)
+    TimerNode(const TimerNode& other)
+        : on_expired{other.on_expired}
+        , context{other.context}
+    { }
+
+    TimerNode& operator=(const TimerNode& other)
+    {
+        on_expired = other.on_expired;
+        context = other.context;
+        return *this;
+    }
+
+    inline ~TimerNode();
+
+    bool is_armed() const
+    {
+        return wheel != nullptr;
+    }
+};
+
+// Hierarchical timing wheel (6 levels x 64 slots, 64^6 ticks range):
+//  - schedule()/cancel() are O(1) - a timer is linked into the slot of the level where its expiry first differs from now
+//  - advance() fires expired timers; higher level slots are cascaded to lower levels when their time comes
+//  - next_expiry() finds the next interesting tick with bit scans over per-level occupancy masks
+class TimerWheel
+{
+public:
+    static constexpr unsigned slot_bits = 6;
+    static constexpr unsigned slots_per_level = 1u << slot_bits;
+    static constexpr unsigned level_count = 6;
+    static constexpr std::uint64_t max_delay = (std::uint64_t{1} << (slot_bits * level_count)) - 1;
+
+    TimerWheel() = default;
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    ~TimerWheel()
+    {
+        for (auto& level : levels_)
+            for (TimerNode* head : level.slots)
+                for (TimerNode* node = head; node; node = node->next)
+                    node->wheel = nullptr;
+    }
+
+    std::uint64_t current_tick() const
+    {
+        return current_tick_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    // timers that are already due fire during the next advance()
+    void schedule(TimerNode& timer, std::uint64_t expiry_tick)
+    {
+        if (timer.is_armed())
+            timer.wheel->cancel(timer);
+
+        if (expiry_tick <= current_tick_)
+            expiry_tick = current_tick_ + 1;
+        if (expiry_tick - current_tick_ > max_delay)
+            expiry_tick = current_tick_ + max_delay;
+
+        timer.expiry_tick = expiry_tick;
+        timer.wheel = this;
+        link(timer);
+        ++size_;
+    }
+
+    void cancel(TimerNode& timer)
+    {
+        if (timer.wheel != this)
+            return;
+
+        unlink(timer);
+        timer.wheel = nullptr;
+        --size_;
+    }
+
+    // moves time forward to target_tick and calls on_expired for every timer that is due
+    void advance(std::uint64_t target_tick)
+    {
+        while (current_tick_ < target_tick)
+        {
+            // lowest non-empty level - nothing happens before its next slot boundary
+            unsigned lowest_level = 0;
+            while (lowest_level < level_count && levels_[lowest_level].occupied == 0)
+                ++lowest_level;
+
+            if (lowest_level == level_count)
+            {
+                current_tick_ = target_tick;
+                return;
+            }
+
+            if (lowest_level > 0)
+            {
+                const std::uint64_t span = std::uint64_t{1} << (slot_bits * lowest_level);
+                const std::uint64_t boundary = (current_tick_ | (span - 1)); // tick preceding the next boundary
+                current_tick_ = std::min(boundary, target_tick);
+                if (current_tick_ == target_tick)
+                    return;
+            }
+
+            ++current_tick_;
+            cascade();
+            fire_slot(levels_[0], current_tick_ & slot_mask);
+        }
+    }
+
+    // tick of the next possible expiry (exact for timers at level 0, a cascade point for higher levels)
+    std::optional<std::uint64_t> next_expiry() const
+    {
+        for (unsigned level = 0; level < level_count; ++level)
+        {
+            const std::uint64_t occupied = levels_[level].occupied;
+            if (occupied == 0)
+                continue;
+
+            // timers of a level always lie in slots after the current one (in the same window of that level)
+            const unsigned shift = slot_bits * level;
+            const unsigned slot = static_cast<unsigned>(std::countr_zero(occupied));
+            const std::uint64_t window_mask = ~((std::uint64_t{1} << (shift + slot_bits)) - 1);
+
+            return (current_tick_ & window_mask) | (std::uint64_t{slot} << shift);
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    static constexpr std::uint64_t slot_mask = slots_per_level - 1;
+
+    struct Level
+    {
+        std::array<TimerNode*, slots_per_level> slots{};
+        std::uint64_t occupied = 0;
+    };
+
+    std::array<Level, level_count> levels_{};
+    std::uint64_t current_tick_ = 0;
+    std::size_t size_ = 0;
+
+    std::pair<unsigned, unsigned> position_of(std::uint64_t expiry_tick) const
+    {
+        const std::uint64_t differing_bits = expiry_tick ^ current_tick_;
+        const unsigned level = differing_bits == 0 ? 0 : (std::bit_width(differing_bits) - 1) / slot_bits;
+        const unsigned slot = (expiry_tick >> (slot_bits * level)) & slot_mask;
+        return {level, slot};
+    }
+
+    void link(TimerNode& timer)
+    {
+        const auto [level, slot] = position_of(timer.expiry_tick);
+        TimerNode*& head = levels_[level].slots[slot];
+
+        timer.prev = nullptr;
+        timer.next = head;
+        if (head)
+            head->prev = &timer;
+        head = &timer;
+
+        levels_[level].occupied |= std::uint64_t{1} << slot;
+    }
+
+    void unlink(TimerNode& timer)
+    {
+        const auto [level, slot] = position_of(timer.expiry_tick);
+        TimerNode*& head = levels_[level].slots[slot];
+
+        if (timer.prev)
+            timer.prev->next = timer.next;
+        else
+            head = timer.next;
+        if (timer.next)
+            timer.next->prev = timer.prev;
+
+        if (!head)
+            levels_[level].occupied &= ~(std::uint64_t{1} << slot);
+
+        timer.prev = timer.next = nullptr;
+    }
+
+    // re-distributes timers of higher level slots that start at the current tick
+    void cascade()
+    {
+        for (unsigned level = 1; level < level_count; ++level)
+        {
+            const unsigned shift = slot_bits * level;
+            if ((current_tick_ & ((std::uint64_t{1} << shift) - 1)) != 0)
+                break;
+
+            const unsigned slot = (current_tick_ >> shift) & slot_mask;
+            TimerNode* node = std::exchange(levels_[level].slots[slot], nullptr);
+            levels_[level].occupied &= ~(std::uint64_t{1} << slot);
+
+            while (node)
+            {
+                TimerNode* next = node->next;
+                link(*node);
+                node = next;
+            }
+        }
+    }
+
+    void fire_slot(Level& level, unsigned slot)
+    {
+        while (TimerNode* node = level.slots[slot])
+        {
+            unlink(*node);
+            node->wheel = nullptr;
+            --size_;
+            node->on_expired(*node); // may re-arm or destroy the node
+        }
+    }
+};
+
+TimerNode::~TimerNode()
+{
+    if (wheel)
+        wheel->cancel(*this);
+}
+
+#endif
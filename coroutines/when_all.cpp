@@ -0,0 +1,209 @@
+#include "scheduler.hpp"
+#include "task.hpp"
+#include "when_all.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    Task<int> delayed_value(Scheduler& scheduler, std::chrono::milliseconds delay, int value)
+    {
+        co_await scheduler.sleep_for(delay);
+        co_return value;
+    }
+
+    Task<> delayed_error(Scheduler& scheduler, std::chrono::milliseconds delay)
+    {
+        co_await scheduler.sleep_for(delay);
+        throw std::runtime_error{"error"};
+    }
+
+    Task<int> fetch_forever(Scheduler& scheduler, int& fetches)
+    {
+        while (true)
+        {
+            co_await scheduler.fetch_data();
+            ++fetches;
+        }
+    }
+
+    Task<> no_op()
+    {
+        co_return;
+    }
+
+    template <typename T>
+    T run_to_completion(Scheduler& scheduler, Task<T> task)
+    {
+        scheduler.submit_task(task);
+        scheduler.run();
+        return std::move(task).result();
+    }
+} // namespace
+
+TEST_CASE("when_all", "[coroutines][when_all]")
+{
+    Scheduler scheduler;
+
+    SECTION("tasks run concurrently")
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        auto [a, b, c] = run_to_completion(scheduler, [](Scheduler& scheduler) -> Task<std::tuple<int, int, std::monostate>> {
+            co_return co_await when_all(delayed_value(scheduler, 30ms, 1), delayed_value(scheduler, 30ms, 2), no_op());
+        }(scheduler));
+
+        CHECK(a == 1);
+        CHECK(b == 2);
+        CHECK(c == std::monostate{});
+        CHECK(std::chrono::steady_clock::now() - start < 60ms);
+    }
+
+    SECTION("vector of tasks")
+    {
+        auto values = run_to_completion(scheduler, [](Scheduler& scheduler) -> Task<std::vector<int>> {
+            std::vector<Task<int>> tasks;
+            for (int i = 0; i < 100; ++i)
+                tasks.push_back(delayed_value(scheduler, std::chrono::milliseconds{i % 7}, i));
+            co_return co_await when_all(std::move(tasks));
+        }(scheduler));
+
+        REQUIRE(values.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            CHECK(values[i] == i);
+    }
+
+    SECTION("failure cancels the other tasks")
+    {
+        int fetches = 0;
+        auto task = [](Scheduler& scheduler, int& fetches) -> Task<> {
+            co_await when_all(delayed_value(scheduler, 10s, 1), fetch_forever(scheduler, fetches), delayed_error(scheduler, 5ms));
+        }(scheduler, fetches);
+
+        const auto start = std::chrono::steady_clock::now();
+        scheduler.submit_task(task);
+        scheduler.run();
+
+        CHECK_THROWS_AS(task.result(), std::runtime_error);
+        CHECK(std::chrono::steady_clock::now() - start < 1s);
+        CHECK(scheduler.pending_timers() == 0);
+        CHECK(fetches > 0);
+    }
+}
+
+TEST_CASE("when_any", "[coroutines][when_all]")
+{
+    Scheduler scheduler;
+
+    SECTION("the first result wins - losers are removed from the scheduler queues")
+    {
+        int fetches = 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        auto result = run_to_completion(scheduler, [](Scheduler& scheduler, int& fetches) -> Task<std::variant<int, int, int>> {
+            co_return co_await when_any(delayed_value(scheduler, 10s, 1), delayed_value(scheduler, 10ms, 2), fetch_forever(scheduler, fetches));
+        }(scheduler, fetches));
+
+        CHECK(result.index() == 1);
+        CHECK(std::get<1>(result) == 2);
+        CHECK(std::chrono::steady_clock::now() - start < 1s);
+        CHECK(scheduler.pending_timers() == 0);
+
+        const auto& stats = scheduler.fetch_stats();
+        CHECK(stats.requests == static_cast<std::size_t>(fetches)); // the cancelled request was never fetched
+    }
+
+    SECTION("hedged requests - vector of tasks")
+    {
+        auto result = run_to_completion(scheduler, [](Scheduler& scheduler) -> Task<WhenAnyResult<int>> {
+            std::vector<Task<int>> hedges;
+            hedges.push_back(delayed_value(scheduler, 200ms, 0));
+            hedges.push_back(delayed_value(scheduler, 5ms, 1));
+            hedges.push_back(delayed_value(scheduler, 100ms, 2));
+            co_return co_await when_any(std::move(hedges));
+        }(scheduler));
+
+        CHECK(result.index == 1);
+        CHECK(result.value == 1);
+        CHECK(scheduler.pending_timers() == 0);
+    }
+
+    SECTION("empty vector of tasks - not a cancellation")
+    {
+        CHECK_THROWS_AS(run_to_completion(scheduler, when_any(std::vector<Task<int>>{})), std::invalid_argument);
+    }
+}
+
+TEST_CASE("cancellation through a stop token", "[coroutines][when_all]")
+{
+    Scheduler scheduler;
+
+    SECTION("stop requested from another thread")
+    {
+        std::stop_source stop_source;
+
+        auto task = [](Scheduler& scheduler) -> Task<std::string> {
+            try
+            {
+                co_await delayed_value(scheduler, 10s, 1); // the stop token is inherited by awaited tasks
+                co_return "completed";
+            }
+            catch (const OperationCancelled&)
+            {
+                co_return "cancelled";
+            }
+        }(scheduler);
+
+        const auto start = std::chrono::steady_clock::now();
+        scheduler.submit_task(task, stop_source.get_token());
+
+        std::jthread canceller{[&stop_source] {
+            std::this_thread::sleep_for(20ms);
+            stop_source.request_stop();
+        }};
+
+        scheduler.run();
+
+        CHECK(task.result() == "cancelled");
+        CHECK(std::chrono::steady_clock::now() - start < 1s);
+        CHECK(scheduler.pending_timers() == 0);
+    }
+
+    SECTION("get_stop_token")
+    {
+        std::stop_source stop_source;
+        stop_source.request_stop();
+
+        auto task = [](Scheduler& scheduler) -> Task<std::pair<bool, bool>> {
+            std::stop_token stop_token = co_await get_stop_token();
+
+            bool fetch_cancelled = false;
+            try
+            {
+                co_await scheduler.fetch_data();
+            }
+            catch (const OperationCancelled&)
+            {
+                fetch_cancelled = true;
+            }
+
+            co_return std::pair{stop_token.stop_requested(), fetch_cancelled};
+        }(scheduler);
+
+        scheduler.submit_task(task, stop_source.get_token());
+        scheduler.run();
+
+        CHECK(task.result() == std::pair{true, true});
+    }
+}
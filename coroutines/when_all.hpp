@@ -0,0 +1,300 @@
+#ifndef WHEN_ALL_HPP
+#define WHEN_ALL_HPP
+
+#include "task.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace details
+{
+    // value type of a task in a group result (std::monostate for Task<void>)
+    template <typename T>
+    using group_value_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    // Members of a group run concurrently - the last one to finish resumes the awaiting coroutine:
+    //  - the group has its own stop source, triggered by a cancellation of the awaiting task
+    //    and (depending on the kind of the group) by the first failure or the first completion
+    struct TaskGroup
+    {
+        static constexpr std::size_t no_winner = static_cast<std::size_t>(-1);
+
+        bool cancel_on_completion; // when_any - the first member to finish cancels the rest
+        std::atomic<std::size_t> remaining{0};
+        std::coroutine_handle<> continuation = nullptr;
+        std::stop_source stop_source;
+        TaskScheduling scheduling; // of the awaiting task - inherited by the members
+
+        std::atomic<bool> decided{false}; // the first completion (when_any) or failure (when_all) has been recorded
+        std::size_t winner = no_winner;
+        std::exception_ptr exception;
+
+        explicit TaskGroup(bool cancel_on_completion)
+            : cancel_on_completion{cancel_on_completion}
+        { }
+
+        void on_member_finished(std::size_t index, std::exception_ptr member_exception)
+        {
+            if (!cancel_on_completion && !member_exception)
+                return;
+
+            if (decided.exchange(true, std::memory_order_acq_rel))
+                return;
+
+            winner = index;
+            exception = std::move(member_exception);
+            stop_source.request_stop();
+        }
+    };
+
+    // lazily started coroutine running one member of a group
+    class GroupMember
+    {
+    public:
+        struct promise_type : TaskPromiseBase
+        {
+            TaskGroup* group = nullptr;
+
+            GroupMember get_return_object()
+            {
+                return GroupMember{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> coro_handle) noexcept
+                {
+                    TaskGroup& group = *coro_handle.promise().group;
+                    if (group.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        return group.continuation;
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() noexcept { }
+            };
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+            void return_void() noexcept { }
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+
+        explicit GroupMember(std::coroutine_handle<promise_type> coro_handle)
+            : coro_handle_{coro_handle}
+        { }
+
+        GroupMember(const GroupMember&) = delete;
+        GroupMember& operator=(const GroupMember&) = delete;
+
+        GroupMember(GroupMember&& other) noexcept
+            : coro_handle_{std::exchange(other.coro_handle_, nullptr)}
+        { }
+
+        ~GroupMember()
+        {
+            if (coro_handle_)
+                coro_handle_.destroy();
+        }
+
+        void start(TaskGroup& group)
+        {
+            coro_handle_.promise().group = &group;
+            coro_handle_.promise().stop_token = group.stop_source.get_token();
+            coro_handle_.promise().scheduling = group.scheduling;
+            coro_handle_.resume();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> coro_handle_;
+    };
+
+    template <typename T>
+    GroupMember run_member(TaskGroup& group, std::size_t index, Task<T>& task, std::optional<group_value_t<T>>& result)
+    {
+        std::exception_ptr exception;
+        try
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await task;
+                result.emplace();
+            }
+            else
+                result.emplace(co_await std::move(task));
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        group.on_member_finished(index, std::move(exception));
+    }
+
+    // starts all members and suspends the awaiting coroutine until every one of them has finished
+    struct GroupAwaiter
+    {
+        struct ForwardStop
+        {
+            TaskGroup* group;
+
+            void operator()() const noexcept
+            {
+                group->stop_source.request_stop();
+            }
+        };
+
+        TaskGroup& group;
+        std::vector<GroupMember>& members;
+        std::optional<std::stop_callback<ForwardStop>> forward_stop;
+
+        bool await_ready() const noexcept { return members.empty(); }
+
+        template <typename TPromise>
+        bool await_suspend(std::coroutine_handle<TPromise> awaiting_coro)
+        {
+            if (std::stop_token stop_token = stop_token_of(awaiting_coro); stop_token.stop_possible())
+                forward_stop.emplace(std::move(stop_token), ForwardStop{&group});
+
+            group.continuation = awaiting_coro;
+            group.scheduling = scheduling_of(awaiting_coro);
+            group.remaining.store(members.size() + 1, std::memory_order_relaxed);
+
+            for (auto& member : members)
+                member.start(group);
+
+            // the last finished member resumes the awaiting coroutine - unless everything finished synchronously
+            return group.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+
+        void await_resume() noexcept
+        {
+            forward_stop.reset();
+        }
+    };
+
+    template <typename T>
+    std::vector<GroupMember> start_members(TaskGroup& group, std::vector<Task<T>>& tasks, std::vector<std::optional<group_value_t<T>>>& results)
+    {
+        std::vector<GroupMember> members;
+        members.reserve(tasks.size());
+        for (std::size_t i = 0; i < tasks.size(); ++i)
+            members.push_back(run_member(group, i, tasks[i], results[i]));
+        return members;
+    }
+
+    template <typename... Ts, std::size_t... Is>
+    std::vector<GroupMember> start_members(TaskGroup& group, std::tuple<Task<Ts>&...> tasks,
+        std::tuple<std::optional<group_value_t<Ts>>...>& results, std::index_sequence<Is...>)
+    {
+        std::vector<GroupMember> members;
+        members.reserve(sizeof...(Ts));
+        (members.push_back(run_member(group, Is, std::get<Is>(tasks), std::get<Is>(results))), ...);
+        return members;
+    }
+} // namespace details
+
+// co_await when_all(task1, task2, ...) - runs the tasks concurrently and returns a tuple of their results
+// (std::monostate for Task<void>); when a task fails the others are cancelled and the first exception is rethrown
+template <typename... Ts>
+Task<std::tuple<details::group_value_t<Ts>...>> when_all(Task<Ts>... tasks)
+{
+    details::TaskGroup group{false};
+    std::tuple<std::optional<details::group_value_t<Ts>>...> results;
+    std::vector<details::GroupMember> members = details::start_members(group, std::tie(tasks...), results, std::index_sequence_for<Ts...>{});
+
+    details::GroupAwaiter group_awaiter{group, members, std::nullopt}; // named - GCC 12 destroys aggregate temporaries of co_await twice
+    co_await group_awaiter;
+
+    if (group.exception)
+        std::rethrow_exception(group.exception);
+
+    co_return std::apply([](auto&... result) { return std::tuple<details::group_value_t<Ts>...>{std::move(*result)...}; }, results);
+}
+
+// co_await when_all(std::move(tasks)) - results in the order of the tasks
+template <typename T>
+Task<std::vector<details::group_value_t<T>>> when_all(std::vector<Task<T>> tasks)
+{
+    details::TaskGroup group{false};
+    std::vector<std::optional<details::group_value_t<T>>> results(tasks.size());
+    std::vector<details::GroupMember> members = details::start_members(group, tasks, results);
+
+    details::GroupAwaiter group_awaiter{group, members, std::nullopt};
+    co_await group_awaiter;
+
+    if (group.exception)
+        std::rethrow_exception(group.exception);
+
+    std::vector<details::group_value_t<T>> values;
+    values.reserve(results.size());
+    for (auto& result : results)
+        values.push_back(std::move(*result));
+    co_return values;
+}
+
+// result of when_any() for a vector of tasks
+template <typename T>
+struct WhenAnyResult
+{
+    std::size_t index;
+    T value;
+};
+
+// co_await when_any(task1, task2, ...) - the result (or exception) of the first task to finish,
+// variant index = index of the task; the other tasks are cancelled and awaited before when_any() completes
+template <typename... Ts>
+Task<std::variant<details::group_value_t<Ts>...>> when_any(Task<Ts>... tasks)
+{
+    static_assert(sizeof...(Ts) > 0, "when_any() requires at least one task");
+
+    details::TaskGroup group{true};
+    std::tuple<std::optional<details::group_value_t<Ts>>...> results;
+    std::vector<details::GroupMember> members = details::start_members(group, std::tie(tasks...), results, std::index_sequence_for<Ts...>{});
+
+    details::GroupAwaiter group_awaiter{group, members, std::nullopt};
+    co_await group_awaiter;
+
+    if (group.exception)
+        std::rethrow_exception(group.exception);
+
+    using Result = std::variant<details::group_value_t<Ts>...>;
+    co_return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        std::optional<Result> result;
+        ((group.winner == Is ? (void)result.emplace(std::in_place_index<Is>, std::move(*std::get<Is>(results))) : void()), ...);
+        return std::move(*result);
+    }(std::index_sequence_for<Ts...>{});
+}
+
+// co_await when_any(std::move(tasks)) - index and result of the first task to finish;
+// throws std::invalid_argument for an empty vector (there is no first task)
+template <typename T>
+Task<WhenAnyResult<details::group_value_t<T>>> when_any(std::vector<Task<T>> tasks)
+{
+    if (tasks.empty())
+        throw std::invalid_argument{"when_any() requires at least one task"};
+
+    details::TaskGroup group{true};
+    std::vector<std::optional<details::group_value_t<T>>> results(tasks.size());
+    std::vector<details::GroupMember> members = details::start_members(group, tasks, results);
+
+    details::GroupAwaiter group_awaiter{group, members, std::nullopt};
+    co_await group_awaiter;
+
+    if (group.exception)
+        std::rethrow_exception(group.exception);
+
+    co_return WhenAnyResult<details::group_value_t<T>>{group.winner, std::move(*results[group.winner])};
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "task.hpp"
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct TaskCounters
+    {
+        std::atomic<int> starts{0};
+        std::atomic<int> steps{0};
+        std::atomic<int> completions{0};
+        std::atomic<int> fetched_sum{0}; // checked on the main thread - Catch2 assertions are not thread-safe
+    };
+
+    Task<> counted_coro(TaskCounters& counters, WorkStealingScheduler& scheduler)
+    {
+        counters.starts.fetch_add(1);
+
+        int value1 = co_await scheduler.fetch_data();
+        counters.steps.fetch_add(1);
+
+        int value2 = co_await scheduler.fetch_data();
+        counters.steps.fetch_add(1);
+
+        counters.fetched_sum.store(value1 + value2);
+
+        counters.completions.fetch_add(1);
+    }
+
+    void run_and_verify(std::size_t worker_count, std::size_t task_count)
+    {
+        WorkStealingScheduler scheduler{worker_count};
+
+        std::vector<TaskCounters> counters(task_count);
+        std::vector<Task<>> tasks;
+        tasks.reserve(task_count);
+
+        for (auto& task_counters : counters)
+        {
+            tasks.push_back(counted_coro(task_counters, scheduler));
+            scheduler.submit_task(tasks.back());
+        }
+
+        scheduler.run();
+
+        CHECK(std::ranges::all_of(counters, [](const TaskCounters& c) { return c.starts == 1; }));
+        CHECK(std::ranges::all_of(counters, [](const TaskCounters& c) { return c.steps == 2; }));
+        CHECK(std::ranges::all_of(counters, [](const TaskCounters& c) { return c.completions == 1; }));
+        CHECK(std::ranges::all_of(counters, [](const TaskCounters& c) { return c.fetched_sum >= 2; }));
+        CHECK(std::ranges::all_of(tasks, [](const Task<>& t) { return t.get_coro_handle().done(); }));
+    }
+} // namespace
+
+TEST_CASE("work stealing scheduler - every coroutine runs to completion exactly once", "[coroutines][scheduler]")
+{
+    SECTION("single worker")
+    {
+        run_and_verify(1, 1'000);
+    }
+
+    SECTION("many workers")
+    {
+        run_and_verify(8, 100'000);
+    }
+
+    SECTION("no tasks")
+    {
+        run_and_verify(4, 0);
+    }
+}
+
+TEST_CASE("work stealing scheduler - can be run many times", "[coroutines][scheduler]")
+{
+    WorkStealingScheduler scheduler{4};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        TaskCounters counters;
+        Task<> task = counted_coro(counters, scheduler);
+        scheduler.submit_task(task);
+
+        scheduler.run();
+
+        CHECK(counters.completions == 1);
+    }
+}
@@ -0,0 +1,219 @@
+#ifndef WORK_STEALING_SCHEDULER_HPP
+#define WORK_STEALING_SCHEDULER_HPP
+
+#include "task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Multi-threaded counterpart of Scheduler:
+//  - every worker thread owns a deque of ready coroutines (LIFO for the owner, FIFO for thieves)
+//  - an idle worker steals from the front of other workers' deques
+//  - run() returns when every submitted task has reached its final suspend point
+class WorkStealingScheduler
+{
+public:
+    explicit WorkStealingScheduler(std::size_t worker_count = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        workers_.reserve(worker_count);
+        for (std::size_t i = 0; i < std::max<std::size_t>(worker_count, 1); ++i)
+            workers_.push_back(std::make_unique<Worker>());
+    }
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    std::size_t worker_count() const
+    {
+        return workers_.size();
+    }
+
+    void submit_coro(std::coroutine_handle<> coro_handle)
+    {
+        // coroutines suspended on a worker thread stay on that worker's deque (cache locality)
+        const std::size_t index = (current_.scheduler == this)
+            ? current_.worker_index
+            : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+
+        {
+            std::lock_guard lk{workers_[index]->mtx};
+            workers_[index]->ready.push_back(coro_handle);
+        }
+
+        work_epoch_.fetch_add(1, std::memory_order_release);
+        work_epoch_.notify_one();
+    }
+
+    template <typename T>
+    void submit_task(Task<T>& task)
+    {
+        auto coro_handle = task.get_coro_handle();
+        coro_handle.promise().pending_tasks_counter = &pending_tasks_;
+        pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+        submit_coro(coro_handle);
+    }
+
+    // co_await scheduler.schedule() - the coroutine continues on a worker thread (idle workers may steal it)
+    auto schedule()
+    {
+        struct ScheduleAwaiter
+        {
+            WorkStealingScheduler& scheduler;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> coro_handle)
+            {
+                scheduler.submit_coro(coro_handle);
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        return ScheduleAwaiter{*this};
+    }
+
+    auto fetch_data()
+    {
+        struct ValueAwaiter
+        {
+            WorkStealingScheduler& scheduler;
+
+            bool await_ready() { return false; }
+
+            void await_suspend(std::coroutine_handle<> coro_handle)
+            {
+                scheduler.submit_coro(coro_handle);
+            }
+
+            int await_resume()
+            {
+                std::random_device rd;
+                std::mt19937 rnd_gen(rd());
+                std::uniform_int_distribution<> distr(1, 100);
+                return distr(rnd_gen);
+            }
+        };
+
+        return ValueAwaiter{*this};
+    }
+
+    void run()
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(workers_.size() - 1);
+
+        for (std::size_t i = 1; i < workers_.size(); ++i)
+            threads.emplace_back([this, i] { worker_loop(i); });
+
+        worker_loop(0); // the calling thread is worker #0
+    }
+
+private:
+    struct alignas(64) Worker
+    {
+        std::mutex mtx;
+        std::deque<std::coroutine_handle<>> ready;
+    };
+
+    struct WorkerContext
+    {
+        WorkStealingScheduler* scheduler;
+        std::size_t worker_index;
+    };
+
+    inline static thread_local WorkerContext current_; // zero-initialized
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<std::size_t> pending_tasks_{0};
+    std::atomic<std::size_t> next_worker_{0};
+    std::atomic<std::uint64_t> work_epoch_{0};
+
+    std::optional<std::coroutine_handle<>> pop_local(std::size_t index)
+    {
+        Worker& worker = *workers_[index];
+        std::lock_guard lk{worker.mtx};
+
+        if (worker.ready.empty())
+            return std::nullopt;
+
+        auto coro_handle = worker.ready.back();
+        worker.ready.pop_back();
+        return coro_handle;
+    }
+
+    std::optional<std::coroutine_handle<>> steal(std::size_t thief_index, std::uint32_t& seed)
+    {
+        const std::size_t count = workers_.size();
+
+        seed ^= seed << 13; // xorshift32 - picks a random first victim
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t victim_index = (seed + i) % count;
+            if (victim_index == thief_index)
+                continue;
+
+            Worker& victim = *workers_[victim_index];
+            std::lock_guard lk{victim.mtx};
+
+            if (!victim.ready.empty())
+            {
+                auto coro_handle = victim.ready.front();
+                victim.ready.pop_front();
+                return coro_handle;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void worker_loop(std::size_t index)
+    {
+        current_ = WorkerContext{this, index};
+        std::uint32_t seed = static_cast<std::uint32_t>(index) * 2654435761u + 1;
+
+        while (true)
+        {
+            const std::uint64_t epoch = work_epoch_.load(std::memory_order_acquire);
+
+            auto coro_handle = pop_local(index);
+            if (!coro_handle)
+                coro_handle = steal(index, seed);
+
+            if (coro_handle)
+            {
+                // the awaiter re-submits the handle if the coroutine suspends again,
+                // so after resume() it may already be running on another worker
+                coro_handle->resume();
+                continue;
+            }
+
+            if (pending_tasks_.load(std::memory_order_acquire) == 0)
+                break;
+
+            // nothing to run or steal - sleep until new work is submitted or the last task completes
+            work_epoch_.wait(epoch, std::memory_order_acquire);
+        }
+
+        // wake up sleeping workers so they can notice that all tasks have completed
+        work_epoch_.fetch_add(1, std::memory_order_release);
+        work_epoch_.notify_all();
+
+        current_ = WorkerContext{};
+    }
+};
+
+#endif
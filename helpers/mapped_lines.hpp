@@ -0,0 +1,198 @@
+#ifndef MAPPED_LINES_HPP
+#define MAPPED_LINES_HPP
+
+#include "tokenizer.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HELPERS_MAPPED_LINES_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace helpers
+{
+    // Read-only view of a whole file - mmap-ed with sequential readahead (MADV_SEQUENTIAL: pages are read ahead
+    // aggressively and dropped soon after they have been read); elsewhere the file is read into memory once
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::filesystem::path& path)
+        {
+#if HELPERS_MAPPED_LINES_MMAP
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd == -1)
+                throw std::system_error{errno, std::generic_category(), "cannot open " + path.string()};
+
+            struct stat info{};
+            if (::fstat(fd, &info) == -1)
+            {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error{error, std::generic_category(), "cannot stat " + path.string()};
+            }
+
+            size_ = static_cast<std::size_t>(info.st_size);
+            if (size_ != 0) // mmap of an empty file fails
+            {
+                void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED)
+                {
+                    const int error = errno;
+                    ::close(fd);
+                    throw std::system_error{error, std::generic_category(), "cannot map " + path.string()};
+                }
+                data_ = static_cast<const char*>(data);
+                ::madvise(data, size_, MADV_SEQUENTIAL); // only a hint - the mapping works without it
+            }
+            ::close(fd); // the mapping keeps the file open
+#else
+            std::ifstream file{path, std::ios::binary};
+            if (!file)
+                throw std::system_error{std::make_error_code(std::errc::no_such_file_or_directory), "cannot open " + path.string()};
+            std::ostringstream contents;
+            contents << file.rdbuf();
+            buffer_ = std::move(contents).str();
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile()
+        {
+#if HELPERS_MAPPED_LINES_MMAP
+            if (data_)
+                ::munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        std::string_view contents() const noexcept
+        {
+            return {data_, size_};
+        }
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+#if !HELPERS_MAPPED_LINES_MMAP
+        std::string buffer_;
+#endif
+    };
+
+    // Lines of a file as std::string_views into its mapping - no allocation per line:
+    //  - lines are found by helpers::tokenize (SIMD), without the '\n' and a '\r' before it (CRLF files)
+    //  - a final '\n' does not start an empty line; blank lines are empty string_views
+    //  - copies of the view share the mapping - the lines are valid while any copy is alive
+    class MappedLines : public std::ranges::view_interface<MappedLines>
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            iterator(TokenView::iterator token, TokenView::iterator last, const char* text_last)
+                : token_{token}
+                , last_{last}
+                , text_last_{text_last}
+            {
+                skip_final_newline();
+            }
+
+            std::string_view operator*() const noexcept
+            {
+                std::string_view line = *token_;
+                if (line.ends_with('\r'))
+                    line.remove_suffix(1);
+                return line;
+            }
+
+            iterator& operator++() noexcept
+            {
+                ++token_;
+                skip_final_newline();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            bool operator==(const iterator& other) const noexcept
+            {
+                return token_ == other.token_;
+            }
+
+        private:
+            TokenView::iterator token_;
+            TokenView::iterator last_;
+            const char* text_last_ = nullptr;
+
+            // the empty token after the final '\n' is not a line
+            void skip_final_newline() noexcept
+            {
+                if (token_ != last_ && (*token_).data() == text_last_)
+                    token_ = last_;
+            }
+        };
+
+        MappedLines() = default;
+
+        explicit MappedLines(const std::filesystem::path& path)
+            : file_{std::make_shared<const MappedFile>(path)}
+            , lines_{tokenize(file_->contents(), '\n')}
+        { }
+
+        iterator begin() const noexcept
+        {
+            return {lines_.begin(), lines_.end(), text_last()};
+        }
+
+        iterator end() const noexcept
+        {
+            return {lines_.end(), lines_.end(), text_last()};
+        }
+
+    private:
+        std::shared_ptr<const MappedFile> file_;
+        TokenView lines_;
+
+        const char* text_last() const noexcept
+        {
+            return file_ ? file_->contents().data() + file_->contents().size() : nullptr;
+        }
+    };
+
+    // for (std::string_view line : helpers::mapped_lines(path)) - throws std::system_error when the file cannot be read
+    inline MappedLines mapped_lines(const std::filesystem::path& path)
+    {
+        return MappedLines{path};
+    }
+} // namespace helpers
+
+#endif
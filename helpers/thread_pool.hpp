@@ -0,0 +1,123 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace helpers
+{
+    // Intrusive unit of work - the submitter owns the item (e.g. it lives in a coroutine frame),
+    // so submitting it to a ThreadPool does not allocate
+    struct WorkItem
+    {
+        void (*execute)(WorkItem& self) = nullptr;
+        WorkItem* next = nullptr;
+    };
+
+    // Fixed-size pool of worker threads executing WorkItems in FIFO order
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(std::size_t thread_count = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            threads_.reserve(thread_count);
+            for (std::size_t i = 0; i < std::max<std::size_t>(thread_count, 1); ++i)
+                threads_.emplace_back([this] { worker_loop(); });
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // pending items are executed before the workers are joined
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lk{mtx_};
+                stopping_ = true;
+            }
+            cv_work_.notify_all();
+        }
+
+        std::size_t size() const
+        {
+            return threads_.size();
+        }
+
+        void submit(WorkItem& item)
+        {
+            item.next = nullptr;
+            {
+                std::lock_guard lk{mtx_};
+                if (tail_)
+                    tail_->next = &item;
+                else
+                    head_ = &item;
+                tail_ = &item;
+            }
+            cv_work_.notify_one();
+        }
+
+        // convenience overload - allocates a work item owning the callable
+        template <typename TFunction>
+            requires(!std::derived_from<std::remove_cvref_t<TFunction>, WorkItem>)
+        void submit(TFunction&& f)
+        {
+            struct CallableItem : WorkItem
+            {
+                std::decay_t<TFunction> f;
+
+                explicit CallableItem(TFunction&& fn)
+                    : WorkItem{&CallableItem::run}
+                    , f{std::forward<TFunction>(fn)}
+                { }
+
+                static void run(WorkItem& self)
+                {
+                    auto* item = static_cast<CallableItem*>(&self);
+                    item->f();
+                    delete item;
+                }
+            };
+
+            submit(*static_cast<WorkItem*>(new CallableItem{std::forward<TFunction>(f)}));
+        }
+
+    private:
+        std::mutex mtx_;
+        std::condition_variable cv_work_;
+        WorkItem* head_ = nullptr;
+        WorkItem* tail_ = nullptr;
+        bool stopping_ = false;
+        std::vector<std::jthread> threads_; // the last member - joined before the queue is destroyed
+
+        void worker_loop()
+        {
+            while (true)
+            {
+                WorkItem* item = nullptr;
+                {
+                    std::unique_lock lk{mtx_};
+                    cv_work_.wait(lk, [this] { return head_ || stopping_; });
+
+                    if (!head_)
+                        return;
+
+                    item = std::exchange(head_, head_->next);
+                    if (!head_)
+                        tail_ = nullptr;
+                }
+
+                item->execute(*item);
+            }
+        }
+    };
+} // namespace helpers
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef TOKENIZER_HPP
+#define TOKENIZER_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HELPERS_TOKENIZER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define HELPERS_TOKENIZER_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace helpers
+{
+    namespace simd
+    {
+        // first occurrence of c in [first, last) - or last; 32 bytes per step with AVX2, 16 with SSE2
+        inline const char* find_byte(const char* first, const char* last, char c) noexcept
+        {
+#if HELPERS_TOKENIZER_AVX2
+            const __m256i needle_32 = _mm256_set1_epi8(c);
+            for (; last - first >= 32; first += 32)
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle_32))))
+                    return first + std::countr_zero(mask);
+            }
+#endif
+#if HELPERS_TOKENIZER_SSE2
+            const __m128i needle_16 = _mm_set1_epi8(c);
+            for (; last - first >= 16; first += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                if (const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle_16))))
+                    return first + std::countr_zero(mask);
+            }
+#endif
+            if (first == last)
+                return last;
+            const void* found = std::memchr(first, static_cast<unsigned char>(c), static_cast<std::size_t>(last - first));
+            return found ? static_cast<const char*>(found) : last;
+        }
+
+        // first occurrence of pattern (at least 2 bytes) in [first, last) - or last:
+        // blocks are filtered by comparing their bytes with the first and the last byte of the pattern at once,
+        // only the candidates are compared with memcmp
+        inline const char* find_pattern(const char* first, const char* last, std::string_view pattern) noexcept
+        {
+            const auto size = static_cast<std::ptrdiff_t>(pattern.size());
+            if (last - first < size)
+                return last;
+
+            const char* const candidates_last = last - size + 1; // the pattern may start only before it
+            const char* const rest = pattern.data() + 1;
+            const auto rest_size = pattern.size() - 2; // bytes between the first and the last one
+
+            [[maybe_unused]] auto first_match = [&](const char* block_first, unsigned mask) -> const char* {
+                for (; mask != 0; mask &= mask - 1)
+                {
+                    const char* candidate = block_first + std::countr_zero(mask);
+                    if (std::memcmp(candidate + 1, rest, rest_size) == 0)
+                        return candidate;
+                }
+                return nullptr;
+            };
+
+#if HELPERS_TOKENIZER_AVX2
+            const __m256i first_byte_32 = _mm256_set1_epi8(pattern.front());
+            const __m256i last_byte_32 = _mm256_set1_epi8(pattern.back());
+            for (; candidates_last - first >= 32; first += 32)
+            {
+                const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + size - 1));
+                const __m256i matches = _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_byte_32), _mm256_cmpeq_epi8(block_last, last_byte_32));
+                if (const char* found = first_match(first, static_cast<unsigned>(_mm256_movemask_epi8(matches))))
+                    return found;
+            }
+#endif
+#if HELPERS_TOKENIZER_SSE2
+            const __m128i first_byte_16 = _mm_set1_epi8(pattern.front());
+            const __m128i last_byte_16 = _mm_set1_epi8(pattern.back());
+            for (; candidates_last - first >= 16; first += 16)
+            {
+                const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + size - 1));
+                const __m128i matches = _mm_and_si128(_mm_cmpeq_epi8(block_first, first_byte_16), _mm_cmpeq_epi8(block_last, last_byte_16));
+                if (const char* found = first_match(first, static_cast<unsigned>(_mm_movemask_epi8(matches))))
+                    return found;
+            }
+#endif
+            for (; first < candidates_last; ++first)
+            {
+                if (*first == pattern.front() && std::memcmp(first + 1, rest, rest_size + 1) == 0)
+                    return first;
+            }
+            return last;
+        }
+    } // namespace simd
+
+    // position of separator in text at or after pos - or std::string_view::npos (like text.find(separator, pos))
+    inline std::size_t find_separator(std::string_view text, std::string_view separator, std::size_t pos = 0) noexcept
+    {
+        if (pos > text.size())
+            return std::string_view::npos;
+        if (separator.empty())
+            return pos;
+
+        const char* last = text.data() + text.size();
+        const char* found = separator.size() == 1 ? simd::find_byte(text.data() + pos, last, separator.front())
+                                                  : simd::find_pattern(text.data() + pos, last, separator);
+        return found == last ? std::string_view::npos : static_cast<std::size_t>(found - text.data());
+    }
+
+    // Lazy range of the tokens of text - the same tokens as text | std::views::split(separator)
+    // (empty tokens between adjacent separators and after a trailing one), found with simd::find_byte/find_pattern;
+    // iterators refer only to the text, so tokens may outlive the view
+    class TokenView : public std::ranges::view_interface<TokenView>
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            std::string_view operator*() const noexcept
+            {
+                return {token_first_, separator_first_};
+            }
+
+            iterator& operator++() noexcept
+            {
+                token_first_ = separator_last_;
+                if (token_first_ == text_last_)
+                {
+                    trailing_empty_ = separator_first_ != separator_last_; // the text ends with a separator
+                    separator_first_ = separator_last_ = token_first_;
+                }
+                else
+                    find_separator();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            bool operator==(const iterator& other) const noexcept
+            {
+                return token_first_ == other.token_first_ && trailing_empty_ == other.trailing_empty_;
+            }
+
+        private:
+            friend class TokenView;
+
+            const char* text_last_ = nullptr;
+            std::string_view separator_;
+            const char* token_first_ = nullptr;
+            const char* separator_first_ = nullptr; // end of the token
+            const char* separator_last_ = nullptr; // start of the next token
+            bool trailing_empty_ = false;
+
+            iterator(const TokenView& view, const char* token_first) noexcept
+                : text_last_{view.text_last()}
+                , separator_{view.separator_}
+                , token_first_{token_first}
+                , separator_first_{token_first}
+                , separator_last_{token_first}
+            { }
+
+            void find_separator() noexcept
+            {
+                if (separator_.empty()) // like split - every element is a token
+                {
+                    separator_first_ = separator_last_ = token_first_ + 1;
+                    return;
+                }
+
+                separator_first_ = separator_.size() == 1 ? simd::find_byte(token_first_, text_last_, separator_.front())
+                                                          : simd::find_pattern(token_first_, text_last_, separator_);
+                separator_last_ = separator_first_ == text_last_ ? text_last_ : separator_first_ + separator_.size();
+            }
+        };
+
+        TokenView() = default;
+
+        TokenView(std::string_view text, std::string_view separator) noexcept
+            : text_{text}
+            , separator_{separator}
+        { }
+
+        // separator kept as a view of a static table - the view has no internal pointers and copies freely
+        TokenView(std::string_view text, char separator) noexcept
+            : text_{text}
+            , separator_{&single_bytes[static_cast<unsigned char>(separator)], 1}
+        { }
+
+        iterator begin() const noexcept
+        {
+            iterator it{*this, text_.data()};
+            if (!text_.empty())
+                it.find_separator();
+            return it;
+        }
+
+        iterator end() const noexcept
+        {
+            return iterator{*this, text_last()};
+        }
+
+    private:
+        static constexpr auto single_bytes = [] {
+            std::array<char, 256> bytes{};
+            for (std::size_t i = 0; i < bytes.size(); ++i)
+                bytes[i] = static_cast<char>(i);
+            return bytes;
+        }();
+
+        std::string_view text_;
+        std::string_view separator_;
+
+        const char* text_last() const noexcept
+        {
+            return text_.data() + text_.size();
+        }
+    };
+
+    // for (std::string_view token : helpers::tokenize(line, ',')) - lazily tokenizes text without copying
+    inline TokenView tokenize(std::string_view text, char separator) noexcept
+    {
+        return TokenView{text, separator};
+    }
+
+    inline TokenView tokenize(std::string_view text, std::string_view separator) noexcept
+    {
+        return TokenView{text, separator};
+    }
+} // namespace helpers
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<helpers::TokenView> = true;
+
+#endif
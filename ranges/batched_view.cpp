@@ -0,0 +1,132 @@
+#include "batched_view.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+TEST_CASE("views::batched", "[ranges][batched]")
+{
+    SECTION("contiguous range - spans of its own elements")
+    {
+        std::vector<int> data(10);
+        std::iota(data.begin(), data.end(), 0);
+
+        auto batches = data | views::batched<4>;
+        static_assert(std::ranges::forward_range<decltype(batches)>);
+        CHECK(batches.size() == 3);
+
+        std::vector<std::size_t> sizes;
+        for (std::span<const int> batch : batches)
+            sizes.push_back(batch.size());
+        CHECK(sizes == std::vector<std::size_t>{4, 4, 2});
+        CHECK((*batches.begin()).data() == data.data()); // nothing is copied
+    }
+
+    SECTION("any other range - blocks copied to a buffer")
+    {
+        auto batches = std::views::iota(1) | std::views::take(10) | std::views::transform([](int x) { return x * x; })
+                     | views::batched<3>;
+
+        std::vector<std::vector<int>> blocks;
+        for (std::span<const int> batch : batches)
+            blocks.emplace_back(batch.begin(), batch.end());
+        CHECK(blocks == std::vector<std::vector<int>>{{1, 4, 9}, {16, 25, 36}, {49, 64, 81}, {100}});
+    }
+
+    SECTION("empty range")
+    {
+        std::vector<int> empty;
+        CHECK(std::ranges::empty(empty | views::batched<8>));
+        CHECK(std::ranges::distance(std::views::iota(0, 0) | views::batched<8>) == 0);
+    }
+}
+
+TEST_CASE("views::batch_transform", "[ranges][batched]")
+{
+    std::vector<int> data(1000);
+    std::iota(data.begin(), data.end(), 0);
+
+    auto expected = data | std::views::transform([](int x) { return 2.0 * x + 1; }) | std::views::filter([](double x) { return x > 100; });
+
+    SECTION("stages pass blocks, unbatch gives the elements back")
+    {
+        auto pipeline = data
+                      | views::batched<64>
+                      | views::batch_transform([](int x) { return 2 * x; })
+                      | views::batch_transform([](int x) { return x + 1.0; })
+                      | views::unbatch
+                      | std::views::filter([](double x) { return x > 100; });
+
+        CHECK(std::ranges::equal(pipeline, expected));
+    }
+
+    SECTION("non-contiguous source")
+    {
+        auto pipeline = std::views::iota(0, 1000)
+                      | views::batched<16>
+                      | views::batch_transform([](int x) { return 2.0 * x + 1; })
+                      | views::unbatch;
+
+        CHECK(std::ranges::equal(pipeline | std::views::filter([](double x) { return x > 100; }), expected));
+    }
+}
+
+// batching pays off when the kernels vectorise (-O3; -fno-math-errno for std::sqrt) and a later stage (filter)
+// would keep the element-wise pipeline from vectorising them
+TEST_CASE("views::batched - element-wise vs batched pipeline", "[.][benchmark][batched]")
+{
+    constexpr int size = 10'000'000;
+    auto kernel = [](int x) {
+        const float value = static_cast<float>(x);
+        return std::sqrt(value) * 0.5f + value * value * 1e-9f;
+    };
+    auto is_large = [](float x) { return x > 100.0f; };
+
+    BENCHMARK("element-wise - iota | transform | filter")
+    {
+        int count = 0;
+        for ([[maybe_unused]] float x : std::views::iota(0, size) | std::views::transform(kernel) | std::views::filter(is_large))
+            ++count;
+        return count;
+    };
+
+    BENCHMARK("batched<256> - iota | batch_transform | unbatch | filter")
+    {
+        int count = 0;
+        for ([[maybe_unused]] float x : std::views::iota(0, size) | views::batched<256> | views::batch_transform(kernel) | views::unbatch
+                                            | std::views::filter(is_large))
+            ++count;
+        return count;
+    };
+
+    BENCHMARK("batched<256> - iota | batch_transform, filtered block by block")
+    {
+        int count = 0;
+        for (std::span<const float> block : std::views::iota(0, size) | views::batched<256> | views::batch_transform(kernel))
+            count += static_cast<int>(std::ranges::count_if(block, is_large));
+        return count;
+    };
+
+    std::vector<int> data(size);
+    std::iota(data.begin(), data.end(), 0);
+    std::vector<float> results(size);
+
+    BENCHMARK("element-wise - vector | transform -> vector")
+    {
+        return std::ranges::copy(data | std::views::transform(kernel), results.begin()).out - results.begin();
+    };
+
+    BENCHMARK("batched<256> - vector | batch_transform -> vector")
+    {
+        auto out = results.begin();
+        for (std::span<const float> block : data | views::batched<256> | views::batch_transform(kernel))
+            out = std::ranges::copy(block, out).out;
+        return out - results.begin();
+    };
+}
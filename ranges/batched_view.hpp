@@ -0,0 +1,338 @@
+#ifndef BATCHED_VIEW_HPP
+#define BATCHED_VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+// Batched pipelines - stages pass blocks of up to N elements (std::span<const T>) instead of single elements:
+//   auto squares = data | views::batched<256> | views::batch_transform([](int x) { return x * x; });
+//   for (std::span<const int> block : squares)
+//       for (int square : block) ...
+// every stage runs a plain loop over a whole block, which the compiler can vectorise even if a later stage
+// (filter, ...) could not be; views::unbatch turns the blocks back into elements
+namespace views_details
+{
+    // a contiguous sized range is cut into spans of its own elements - nothing is copied
+    template <std::ranges::view TView, std::size_t N>
+        requires std::ranges::contiguous_range<TView> && std::ranges::sized_range<TView>
+    class ContiguousBatchedView : public std::ranges::view_interface<ContiguousBatchedView<TView, N>>
+    {
+    public:
+        using value_type = std::remove_cv_t<std::ranges::range_value_t<TView>>;
+        static constexpr std::size_t batch_size = N;
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::span<const ContiguousBatchedView::value_type>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            iterator(const ContiguousBatchedView::value_type* first, const ContiguousBatchedView::value_type* last)
+                : first_{first}
+                , last_{last}
+            { }
+
+            value_type operator*() const noexcept
+            {
+                return {first_, std::min<std::size_t>(N, static_cast<std::size_t>(last_ - first_))};
+            }
+
+            iterator& operator++() noexcept
+            {
+                first_ += std::min<std::size_t>(N, static_cast<std::size_t>(last_ - first_));
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            bool operator==(const iterator& other) const noexcept
+            {
+                return first_ == other.first_;
+            }
+
+        private:
+            const ContiguousBatchedView::value_type* first_ = nullptr;
+            const ContiguousBatchedView::value_type* last_ = nullptr;
+        };
+
+        ContiguousBatchedView() = default;
+
+        explicit ContiguousBatchedView(TView base)
+            : base_{std::move(base)}
+        { }
+
+        iterator begin() const
+        {
+            return {data(), data() + std::ranges::size(base_)};
+        }
+
+        iterator end() const
+        {
+            return {data() + std::ranges::size(base_), data() + std::ranges::size(base_)};
+        }
+
+        std::size_t size() const
+        {
+            return (std::ranges::size(base_) + N - 1) / N;
+        }
+
+    private:
+        TView base_;
+
+        const value_type* data() const
+        {
+            return std::to_address(std::ranges::begin(base_));
+        }
+    };
+
+    // any other range (iota | transform | ...) is copied block by block into a buffer of the view - an input range
+    template <std::ranges::view TView, std::size_t N>
+    class BufferedBatchedView : public std::ranges::view_interface<BufferedBatchedView<TView, N>>
+    {
+    public:
+        using value_type = std::remove_cv_t<std::ranges::range_value_t<TView>>;
+        static constexpr std::size_t batch_size = N;
+
+        class iterator
+        {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = std::span<const BufferedBatchedView::value_type>;
+            using difference_type = std::ptrdiff_t;
+
+            explicit iterator(BufferedBatchedView& parent)
+                : parent_{&parent}
+            { }
+
+            value_type operator*() const noexcept
+            {
+                return {parent_->buffer_.data(), parent_->buffer_size_};
+            }
+
+            iterator& operator++()
+            {
+                parent_->fill_buffer();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            bool operator==(std::default_sentinel_t) const noexcept
+            {
+                return parent_->buffer_size_ == 0;
+            }
+
+        private:
+            BufferedBatchedView* parent_;
+        };
+
+        explicit BufferedBatchedView(TView base)
+            : base_{std::move(base)}
+        { }
+
+        iterator begin()
+        {
+            current_ = std::ranges::begin(base_);
+            fill_buffer();
+            return iterator{*this};
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return {};
+        }
+
+    private:
+        TView base_;
+        std::ranges::iterator_t<TView> current_{};
+        std::array<value_type, N> buffer_{};
+        std::size_t buffer_size_ = 0;
+
+        void fill_buffer()
+        {
+            const auto last = std::ranges::end(base_);
+            if constexpr (std::ranges::random_access_range<TView> && std::sized_sentinel_for<std::ranges::sentinel_t<TView>, std::ranges::iterator_t<TView>>)
+            {
+                // counted loop without a comparison with the sentinel per element - vectorisable for iota | transform
+                buffer_size_ = static_cast<std::size_t>(std::min<std::ranges::range_difference_t<TView>>(N, last - current_));
+                for (std::size_t i = 0; i < buffer_size_; ++i)
+                    buffer_[i] = current_[static_cast<std::ranges::range_difference_t<TView>>(i)];
+                current_ += static_cast<std::ranges::range_difference_t<TView>>(buffer_size_);
+            }
+            else
+            {
+                for (buffer_size_ = 0; buffer_size_ < N && current_ != last; ++buffer_size_, ++current_)
+                    buffer_[buffer_size_] = *current_;
+            }
+        }
+    };
+
+    // views::batched<N> or views::batch_transform on top of it
+    template <typename TView>
+    concept BatchedRange = std::ranges::input_range<TView> && requires { std::remove_cvref_t<TView>::batch_size; };
+
+    // f applied to every element of every block - the results of a block are written to a buffer of the view
+    template <std::ranges::view TView, std::copy_constructible TFunction>
+        requires BatchedRange<TView>
+    class BatchTransformView : public std::ranges::view_interface<BatchTransformView<TView, TFunction>>
+    {
+        using Input = typename TView::value_type;
+
+    public:
+        using value_type = std::remove_cvref_t<std::invoke_result_t<TFunction&, const Input&>>;
+        static constexpr std::size_t batch_size = TView::batch_size;
+
+        class iterator
+        {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = std::span<const BatchTransformView::value_type>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator(BatchTransformView& parent, std::ranges::iterator_t<TView> current)
+                : parent_{&parent}
+                , current_{std::move(current)}
+            {
+                transform_block();
+            }
+
+            value_type operator*() const noexcept
+            {
+                return {parent_->buffer_.data(), parent_->buffer_size_};
+            }
+
+            iterator& operator++()
+            {
+                ++current_;
+                transform_block();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            bool operator==(const std::ranges::sentinel_t<TView>& last) const
+            {
+                return current_ == last;
+            }
+
+        private:
+            BatchTransformView* parent_;
+            std::ranges::iterator_t<TView> current_;
+
+            void transform_block()
+            {
+                if (current_ == std::ranges::end(parent_->base_))
+                    return;
+
+                const std::span<const Input> block = *current_;
+                auto& f = parent_->f_;
+                auto* out = parent_->buffer_.data();
+                for (std::size_t i = 0; i < block.size(); ++i) // a plain loop over the block - vectorisable
+                    out[i] = std::invoke(f, block[i]);
+                parent_->buffer_size_ = block.size();
+            }
+        };
+
+        BatchTransformView(TView base, TFunction f)
+            : base_{std::move(base)}
+            , f_{std::move(f)}
+        { }
+
+        iterator begin()
+        {
+            return iterator{*this, std::ranges::begin(base_)};
+        }
+
+        auto end()
+        {
+            return std::ranges::end(base_);
+        }
+
+    private:
+        TView base_;
+        TFunction f_;
+        std::array<value_type, batch_size> buffer_{};
+        std::size_t buffer_size_ = 0;
+    };
+
+    template <std::size_t N>
+    struct BatchedAdaptor
+    {
+        template <std::ranges::viewable_range TRange>
+        auto operator()(TRange&& range) const
+        {
+            using View = std::views::all_t<TRange>;
+            if constexpr (std::ranges::contiguous_range<View> && std::ranges::sized_range<View>)
+                return ContiguousBatchedView<View, N>{std::views::all(std::forward<TRange>(range))};
+            else
+                return BufferedBatchedView<View, N>{std::views::all(std::forward<TRange>(range))};
+        }
+
+        template <std::ranges::viewable_range TRange>
+        friend auto operator|(TRange&& range, const BatchedAdaptor& adaptor)
+        {
+            return adaptor(std::forward<TRange>(range));
+        }
+    };
+
+    template <typename TFunction>
+    struct BatchTransformClosure
+    {
+        TFunction f;
+
+        template <std::ranges::viewable_range TRange>
+            requires BatchedRange<TRange>
+        friend auto operator|(TRange&& range, BatchTransformClosure closure)
+        {
+            return BatchTransformView<std::views::all_t<TRange>, TFunction>{std::views::all(std::forward<TRange>(range)), std::move(closure.f)};
+        }
+    };
+
+    struct BatchTransformAdaptor
+    {
+        template <typename TFunction>
+        auto operator()(TFunction f) const
+        {
+            return BatchTransformClosure<TFunction>{std::move(f)};
+        }
+    };
+} // namespace views_details
+
+namespace views
+{
+    // range | views::batched<N> - blocks (std::span<const T>) of N elements, the last one may be shorter
+    template <std::size_t N>
+        requires(N > 0)
+    inline constexpr views_details::BatchedAdaptor<N> batched{};
+
+    // batched | views::batch_transform(f) - f(element) for every element, computed a whole block at a time
+    inline constexpr views_details::BatchTransformAdaptor batch_transform{};
+
+    // batched | views::unbatch - the elements of the blocks
+    inline constexpr auto unbatch = std::views::join;
+} // namespace views
+
+#endif
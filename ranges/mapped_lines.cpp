@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <mapped_lines.hpp>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // file in the temp directory, removed at the end of the test
+    class TempFile
+    {
+    public:
+        TempFile(std::string_view name, std::string_view contents)
+            : path_{std::filesystem::temp_directory_path() / name}
+        {
+            std::ofstream file{path_, std::ios::binary};
+            file << contents;
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            std::error_code ignored;
+            std::filesystem::remove(path_, ignored);
+        }
+
+        const std::filesystem::path& path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        std::filesystem::path path_;
+    };
+
+    // lines copied out - the mapping is gone with the file
+    std::vector<std::string> lines_of(std::string_view contents)
+    {
+        TempFile file{"mapped-lines.txt", contents};
+        std::vector<std::string> lines;
+        for (std::string_view line : helpers::mapped_lines(file.path()))
+            lines.emplace_back(line);
+        return lines;
+    }
+} // namespace
+
+TEST_CASE("mapped_lines", "[ranges][mapped_lines]")
+{
+    static_assert(std::ranges::forward_range<helpers::MappedLines>);
+    static_assert(std::ranges::view<helpers::MappedLines>);
+
+    SECTION("lines without the '\\n'")
+    {
+        CHECK(lines_of("one\ntwo\nthree\n") == std::vector{"one"s, "two"s, "three"s});
+    }
+
+    SECTION("last line without '\\n'")
+    {
+        CHECK(lines_of("one\ntwo") == std::vector{"one"s, "two"s});
+    }
+
+    SECTION("blank lines are empty")
+    {
+        CHECK(lines_of("one\n\n\ntwo\n\n") == std::vector{"one"s, ""s, ""s, "two"s, ""s});
+        CHECK(lines_of("\n") == std::vector{""s});
+    }
+
+    SECTION("CRLF")
+    {
+        CHECK(lines_of("one\r\ntwo\r\n\r\n") == std::vector{"one"s, "two"s, ""s});
+    }
+
+    SECTION("empty file")
+    {
+        CHECK(lines_of("").empty());
+    }
+
+    SECTION("lines point into the mapping - copies of the view share it")
+    {
+        TempFile file{"mapped-lines-shared.txt", "a/1\nb/2\n"};
+        helpers::MappedLines copy;
+        {
+            auto lines = helpers::mapped_lines(file.path());
+            copy = lines;
+            CHECK((*lines.begin()).data() == (*copy.begin()).data());
+        }
+        CHECK(std::ranges::equal(copy, std::vector{"a/1"sv, "b/2"sv}));
+    }
+
+    SECTION("missing file")
+    {
+        CHECK_THROWS_AS(helpers::mapped_lines(std::filesystem::temp_directory_path() / "mapped-lines-missing.txt"), std::system_error);
+    }
+}
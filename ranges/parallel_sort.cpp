@@ -0,0 +1,203 @@
+#include "parallel_sort.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread_pool.hpp>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::vector<int> random_ints(std::size_t size, std::uint64_t seed, int max_value = 1'000'000)
+    {
+        helpers::random::PCG rnd{seed};
+        std::vector<int> data(size);
+        for (int& n : data)
+            n = static_cast<int>(rnd() % static_cast<std::uint32_t>(max_value));
+        return data;
+    }
+
+    std::vector<std::string> random_words(std::size_t size, std::uint64_t seed)
+    {
+        helpers::random::PCG rnd{seed};
+        std::vector<std::string> words(size);
+        for (auto& word : words)
+        {
+            word.resize(1 + rnd() % 24);
+            for (char& c : word)
+                c = static_cast<char>('a' + rnd() % 26);
+        }
+        return words;
+    }
+} // namespace
+
+TEST_CASE("par::sort", "[ranges][parallel_sort]")
+{
+    helpers::ThreadPool pool{4};
+
+    SECTION("comparator and projection - like std::ranges::sort")
+    {
+        auto words = random_words(100'000, 42);
+        auto expected = words;
+        std::ranges::sort(expected, std::greater{}, std::ranges::size);
+
+        par::sort(pool, words, std::greater{}, std::ranges::size);
+
+        CHECK(std::ranges::is_sorted(words, std::greater{}, std::ranges::size));
+        std::ranges::sort(words); // only the lengths are ordered - the same elements
+        std::ranges::sort(expected);
+        CHECK(words == expected);
+    }
+
+    SECTION("sizes around the sequential threshold")
+    {
+        for (std::ptrdiff_t size : std::vector<std::ptrdiff_t>{0, 1, 1000, par::sequential_threshold - 1, par::sequential_threshold, 3 * par::sequential_threshold + 7})
+        {
+            auto data = random_ints(static_cast<std::size_t>(size), 7, 100); // many duplicates
+            auto expected = data;
+            std::ranges::sort(expected);
+
+            auto last = par::sort(pool, data);
+
+            CHECK(last == data.end());
+            CHECK(data == expected);
+        }
+    }
+
+    SECTION("sorted, reversed and iterator + sentinel overload")
+    {
+        std::vector<int> data(200'000);
+        std::ranges::generate(data, [n = 0]() mutable { return n++; });
+        std::ranges::reverse(data);
+
+        par::sort(pool, data.begin(), data.end());
+        CHECK(std::ranges::is_sorted(data));
+
+        par::sort(pool, data.begin(), data.end());
+        CHECK(std::ranges::is_sorted(data));
+    }
+
+    SECTION("default pool")
+    {
+        auto data = random_ints(500'000, 665);
+        par::sort(data, std::greater{});
+        CHECK(std::ranges::is_sorted(data, std::greater{}));
+    }
+
+    SECTION("an exception thrown by the comparator is rethrown")
+    {
+        auto data = random_ints(200'000, 1);
+        auto throwing_less = [](int a, int b) {
+            if (a == 0 || b == 0)
+                throw std::runtime_error{"zero"};
+            return a < b;
+        };
+        data[123'456] = 0;
+
+        CHECK_THROWS_AS(par::sort(pool, data, throwing_less), std::runtime_error);
+    }
+}
+
+TEST_CASE("par::stable_sort", "[ranges][parallel_sort]")
+{
+    helpers::ThreadPool pool{3}; // rounded up to 4 runs
+
+    std::vector<std::pair<int, int>> data; // {key, original position}
+    for (int key : random_ints(300'000, 13, 50))
+        data.emplace_back(key, static_cast<int>(data.size()));
+    auto expected = data;
+    std::ranges::stable_sort(expected, std::less{}, &std::pair<int, int>::first);
+
+    par::stable_sort(pool, data, std::less{}, &std::pair<int, int>::first);
+
+    CHECK(data == expected); // equal keys keep their order
+}
+
+TEST_CASE("par::sort - move-only element without a default constructor", "[ranges][parallel_sort]")
+{
+    struct Item
+    {
+        std::unique_ptr<int> value;
+
+        explicit Item(int v)
+            : value{std::make_unique<int>(v)}
+        { }
+    };
+    static_assert(!std::default_initializable<Item>);
+
+    helpers::ThreadPool pool{4};
+
+    const auto keys = random_ints(100'000, 99);
+    std::vector<Item> items;
+    for (int key : keys)
+        items.emplace_back(key);
+    auto expected = keys;
+    std::ranges::sort(expected);
+
+    par::sort(pool, items, std::less{}, [](const Item& item) { return *item.value; });
+
+    REQUIRE(std::ranges::all_of(items, [](const Item& item) { return item.value != nullptr; })); // nothing is left moved-from
+    CHECK(std::ranges::equal(items, expected, {}, [](const Item& item) { return *item.value; }));
+}
+
+// every run sorts a fresh copy - the copy is a part of each measurement
+TEST_CASE("par::sort - 10M elements", "[.][benchmark][parallel_sort]")
+{
+    const auto ints = random_ints(10'000'000, 42, 1 << 30);
+    const auto words = random_words(10'000'000, 42);
+
+    auto sorted_copy = [](const auto& input, auto sort) {
+        auto data = input;
+        sort(data);
+        return data.size();
+    };
+
+    BENCHMARK("std::ranges::sort - int")
+    {
+        return sorted_copy(ints, [](auto& data) { std::ranges::sort(data); });
+    };
+
+    BENCHMARK("par::sort - int")
+    {
+        return sorted_copy(ints, [](auto& data) { par::sort(data); });
+    };
+
+    BENCHMARK("std::ranges::stable_sort - int")
+    {
+        return sorted_copy(ints, [](auto& data) { std::ranges::stable_sort(data); });
+    };
+
+    BENCHMARK("par::stable_sort - int")
+    {
+        return sorted_copy(ints, [](auto& data) { par::stable_sort(data); });
+    };
+
+    BENCHMARK("std::ranges::sort - std::string")
+    {
+        return sorted_copy(words, [](auto& data) { std::ranges::sort(data); });
+    };
+
+    BENCHMARK("par::sort - std::string")
+    {
+        return sorted_copy(words, [](auto& data) { par::sort(data); });
+    };
+
+    BENCHMARK("std::ranges::sort - std::string by length (projection)")
+    {
+        return sorted_copy(words, [](auto& data) { std::ranges::sort(data, std::greater{}, std::ranges::size); });
+    };
+
+    BENCHMARK("par::sort - std::string by length (projection)")
+    {
+        return sorted_copy(words, [](auto& data) { par::sort(data, std::greater{}, std::ranges::size); });
+    };
+}
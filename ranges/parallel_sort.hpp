@@ -0,0 +1,248 @@
+#ifndef PARALLEL_SORT_HPP
+#define PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <latch>
+#include <mutex>
+#include <ranges>
+#include <thread_pool.hpp>
+#include <utility>
+#include <vector>
+
+namespace par
+{
+    // smaller ranges are sorted sequentially - splitting them costs more than it saves
+    inline constexpr std::ptrdiff_t sequential_threshold = 1 << 15;
+
+    // pool used by the overloads without a pool argument
+    inline helpers::ThreadPool& default_pool()
+    {
+        static helpers::ThreadPool pool;
+        return pool;
+    }
+
+    namespace details
+    {
+        // f(0) ... f(count - 1) - f(0) on the calling thread, the rest on the pool; the first exception is rethrown
+        template <typename TFunction>
+        void parallel_for(helpers::ThreadPool& pool, std::size_t count, TFunction f)
+        {
+            std::latch done{static_cast<std::ptrdiff_t>(count)};
+            std::exception_ptr error;
+            std::once_flag error_flag;
+
+            auto run = [&](std::size_t index) {
+                try
+                {
+                    f(index);
+                }
+                catch (...)
+                {
+                    std::call_once(error_flag, [&] { error = std::current_exception(); });
+                }
+                done.count_down();
+            };
+
+            for (std::size_t index = 1; index < count; ++index)
+                pool.submit([&run, index] { run(index); });
+            run(0);
+            done.wait();
+
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        // stable merge of [first1, last1) and [first2, last2) moved to out - on ties the element of the first run goes first
+        template <typename TInput, typename TOutput, typename TCompare, typename TProjection>
+        void merge_move(TInput first1, TInput last1, TInput first2, TInput last2, TOutput out, TCompare& comp, TProjection& proj)
+        {
+            for (; first1 != last1 && first2 != last2; ++out)
+            {
+                if (std::invoke(comp, std::invoke(proj, *first2), std::invoke(proj, *first1)))
+                    *out = std::ranges::iter_move(first2++);
+                else
+                    *out = std::ranges::iter_move(first1++);
+            }
+            out = std::ranges::move(first1, last1, out).out;
+            std::ranges::move(first2, last2, out);
+        }
+
+        // one round of the merge sort - pairs of runs of src are merged into dst;
+        // every pair is cut into pieces at the split points of its left run (found in the right run by lower_bound),
+        // so all workers take part also in the last rounds with few long runs
+        template <typename TSource, typename TDestination, typename TCompare, typename TProjection>
+        void merge_round(helpers::ThreadPool& pool, TSource src, TDestination dst, const std::vector<std::ptrdiff_t>& bounds,
+            std::size_t width, TCompare& comp, TProjection& proj)
+        {
+            const std::size_t runs = bounds.size() - 1;
+            const std::size_t pieces_per_pair = 2 * width;
+
+            // all split points are found before any element is moved out of src
+            std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> splits(runs);
+            for (std::size_t task = 0; task < runs; ++task)
+            {
+                const std::size_t pair = task / pieces_per_pair;
+                const std::size_t piece = task % pieces_per_pair;
+
+                const std::ptrdiff_t lo = bounds[pair * pieces_per_pair];
+                const std::ptrdiff_t mid = bounds[pair * pieces_per_pair + width];
+                const std::ptrdiff_t left = lo + (mid - lo) * static_cast<std::ptrdiff_t>(piece) / static_cast<std::ptrdiff_t>(pieces_per_pair);
+                if (piece == 0)
+                    splits[task] = {lo, mid};
+                else
+                {
+                    const std::ptrdiff_t hi = bounds[(pair + 1) * pieces_per_pair];
+                    auto right = std::ranges::lower_bound(src + mid, src + hi, std::invoke(proj, src[left]), comp, proj);
+                    splits[task] = {left, right - src};
+                }
+            }
+
+            parallel_for(pool, runs, [&](std::size_t task) {
+                const std::size_t pair = task / pieces_per_pair;
+                const std::ptrdiff_t mid = bounds[pair * pieces_per_pair + width];
+                const std::ptrdiff_t hi = bounds[(pair + 1) * pieces_per_pair];
+
+                const auto [left_first, right_first] = splits[task];
+                const auto [left_last, right_last] = task % pieces_per_pair == pieces_per_pair - 1
+                                                       ? std::pair{mid, hi} // the last piece of the pair
+                                                       : splits[task + 1];
+
+                merge_move(src + left_first, src + left_last, src + right_first, src + right_last,
+                    dst + (left_first + right_first - mid), comp, proj);
+            });
+        }
+
+        template <bool Stable, typename TIterator, typename TCompare, typename TProjection>
+        void sort(helpers::ThreadPool& pool, TIterator first, TIterator last, TCompare& comp, TProjection& proj)
+        {
+            using Value = std::iter_value_t<TIterator>;
+
+            const std::ptrdiff_t size = last - first;
+            if (size < sequential_threshold || pool.size() < 2)
+            {
+                if constexpr (Stable)
+                    std::ranges::stable_sort(first, last, comp, proj);
+                else
+                    std::ranges::sort(first, last, comp, proj);
+                return;
+            }
+
+            // runs sorted independently, then merged pairwise in log2(runs) rounds (data -> buffer -> data ...)
+            const std::size_t runs = std::bit_ceil(pool.size());
+            std::vector<std::ptrdiff_t> bounds(runs + 1);
+            for (std::size_t i = 0; i <= runs; ++i)
+                bounds[i] = size * static_cast<std::ptrdiff_t>(i) / static_cast<std::ptrdiff_t>(runs);
+
+            parallel_for(pool, runs, [&](std::size_t run) {
+                if constexpr (Stable)
+                    std::ranges::stable_sort(first + bounds[run], first + bounds[run + 1], comp, proj);
+                else
+                    std::ranges::sort(first + bounds[run], first + bounds[run + 1], comp, proj);
+            });
+
+            // without a default constructor the buffer is made of the (sorted) runs - the first round merges them back
+            std::vector<Value> buffer;
+            bool in_buffer = false;
+            if constexpr (std::default_initializable<Value>)
+                buffer.resize(static_cast<std::size_t>(size));
+            else
+            {
+                buffer.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+                in_buffer = true;
+            }
+
+            for (std::size_t width = 1; width < runs; width *= 2, in_buffer = !in_buffer)
+            {
+                if (in_buffer)
+                    merge_round(pool, buffer.begin(), first, bounds, width, comp, proj);
+                else
+                    merge_round(pool, first, buffer.begin(), bounds, width, comp, proj);
+            }
+
+            if (in_buffer)
+                parallel_for(pool, runs, [&](std::size_t run) {
+                    std::ranges::move(buffer.begin() + bounds[run], buffer.begin() + bounds[run + 1], first + bounds[run]);
+                });
+        }
+    } // namespace details
+
+    // par::sort(range, comp, proj) - like std::ranges::sort, runs on the worker threads of a helpers::ThreadPool:
+    //  - the range is cut into one run per worker (rounded up to a power of two), the runs are sorted in parallel
+    //    and merged pairwise - every merge is split into pieces, so all workers are busy until the end
+    //  - ranges smaller than sequential_threshold are sorted by std::ranges::sort on the calling thread
+    //  - needs a temporary buffer of the size of the range; the first exception thrown by comp or proj is rethrown
+    //  - must not be called from a task of the same pool - the calling thread waits for the workers
+    template <std::random_access_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename TCompare = std::ranges::less,
+        typename TProjection = std::identity>
+        requires std::sortable<TIterator, TCompare, TProjection>
+    TIterator sort(helpers::ThreadPool& pool, TIterator first, TSentinel last, TCompare comp = {}, TProjection proj = {})
+    {
+        TIterator last_it = std::ranges::next(first, last);
+        details::sort<false>(pool, first, last_it, comp, proj);
+        return last_it;
+    }
+
+    template <std::random_access_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename TCompare = std::ranges::less,
+        typename TProjection = std::identity>
+        requires std::sortable<TIterator, TCompare, TProjection>
+    TIterator sort(TIterator first, TSentinel last, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::sort(default_pool(), first, last, std::move(comp), std::move(proj));
+    }
+
+    template <std::ranges::random_access_range TRange, typename TCompare = std::ranges::less, typename TProjection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<TRange>, TCompare, TProjection>
+    std::ranges::borrowed_iterator_t<TRange> sort(helpers::ThreadPool& pool, TRange&& range, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::sort(pool, std::ranges::begin(range), std::ranges::end(range), std::move(comp), std::move(proj));
+    }
+
+    template <std::ranges::random_access_range TRange, typename TCompare = std::ranges::less, typename TProjection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<TRange>, TCompare, TProjection>
+    std::ranges::borrowed_iterator_t<TRange> sort(TRange&& range, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::sort(default_pool(), std::ranges::begin(range), std::ranges::end(range), std::move(comp), std::move(proj));
+    }
+
+    // par::stable_sort(range, comp, proj) - like par::sort, equivalent elements keep their order
+    // (runs are sorted by std::ranges::stable_sort, merges take the element of the left run on ties)
+    template <std::random_access_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename TCompare = std::ranges::less,
+        typename TProjection = std::identity>
+        requires std::sortable<TIterator, TCompare, TProjection>
+    TIterator stable_sort(helpers::ThreadPool& pool, TIterator first, TSentinel last, TCompare comp = {}, TProjection proj = {})
+    {
+        TIterator last_it = std::ranges::next(first, last);
+        details::sort<true>(pool, first, last_it, comp, proj);
+        return last_it;
+    }
+
+    template <std::random_access_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename TCompare = std::ranges::less,
+        typename TProjection = std::identity>
+        requires std::sortable<TIterator, TCompare, TProjection>
+    TIterator stable_sort(TIterator first, TSentinel last, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::stable_sort(default_pool(), first, last, std::move(comp), std::move(proj));
+    }
+
+    template <std::ranges::random_access_range TRange, typename TCompare = std::ranges::less, typename TProjection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<TRange>, TCompare, TProjection>
+    std::ranges::borrowed_iterator_t<TRange> stable_sort(helpers::ThreadPool& pool, TRange&& range, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::stable_sort(pool, std::ranges::begin(range), std::ranges::end(range), std::move(comp), std::move(proj));
+    }
+
+    template <std::ranges::random_access_range TRange, typename TCompare = std::ranges::less, typename TProjection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<TRange>, TCompare, TProjection>
+    std::ranges::borrowed_iterator_t<TRange> stable_sort(TRange&& range, TCompare comp = {}, TProjection proj = {})
+    {
+        return par::stable_sort(default_pool(), std::ranges::begin(range), std::ranges::end(range), std::move(comp), std::move(proj));
+    }
+} // namespace par
+
+#endif
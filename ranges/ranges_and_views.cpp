@@ -1,5 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <helpers.hpp>
+#include <tokenizer.hpp>
+#include "value_sentinel.hpp"
 #include <iostream>
 #include <ranges>
 #include <string>
@@ -46,15 +48,6 @@ TEST_CASE("ranges", "[ranges]")
     }
 }
 
-template <auto Value>
-struct EndValue
-{
-    bool operator==(auto it) const
-    {
-        return *it == Value;
-    }
-};
-
 TEST_CASE("sentinels", "[ranges]")
 {
     std::vector data = {2, 3, 4, 1, 5, 42, 6, 7, 8, 9, 10};
@@ -65,11 +58,20 @@ TEST_CASE("sentinels", "[ranges]")
     // TODO - sort range [begin; 42) in descending order
     auto sentinel = EndValue<42>{};
     std::ranges::sort(data.begin(), sentinel); 
+    auto sorted_end = sentinels::sort(data.begin(), sentinel, std::greater{}); // [begin; 42) found by a SIMD scan
+    CHECK(*sorted_end == 42);
+    CHECK(std::ranges::is_sorted(data.begin(), sorted_end, std::greater{}));
 
     EndValue<'\0'> null_term;
     auto& txt = "acbgdef\0ajdhfgajsdhfgkasdjhfg"; // const char(&txt)[30]
     std::string str;
     std::ranges::copy(std::ranges::begin(txt), null_term, std::back_inserter(str));
+    CHECK(str == "acbgdef");
+
+    // the same with the end found by strlen/SIMD scan first
+    str.clear();
+    sentinels::copy(std::ranges::begin(txt), null_term, std::back_inserter(str));
+    CHECK(str == "acbgdef");
 
     helpers::print(data, "data");
 }
@@ -184,10 +186,8 @@ TEST_CASE("views - reference semantics")
 
 std::vector<std::string_view> tokenize(std::string_view text, auto separator = ' ')
 {
-    auto tokens = text 
-        | std::views::split(separator) 
-        | std::views::transform([](auto token) { return std::string_view(token.begin(), token.end()); });
- 
+    auto tokens = helpers::tokenize(text, separator); // SIMD scan - the same tokens as text | std::views::split(separator)
+
     std::vector<std::string_view> tokens_sv(tokens.begin(), tokens.end());
 
     return tokens_sv;
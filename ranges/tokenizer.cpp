@@ -0,0 +1,112 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <random.hpp>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tokenizer.hpp>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    std::vector<std::string_view> split_tokens(std::string_view text, std::string_view separator)
+    {
+        std::vector<std::string_view> tokens;
+        for (auto token : text | std::views::split(separator))
+            tokens.emplace_back(token.begin(), token.end());
+        return tokens;
+    }
+
+    std::vector<std::string_view> simd_tokens(std::string_view text, std::string_view separator)
+    {
+        auto tokens = helpers::tokenize(text, separator);
+        return {tokens.begin(), tokens.end()};
+    }
+
+    // few distinct bytes - separators, their prefixes and adjacent separators are frequent
+    std::string random_text(helpers::random::PCG& rnd, std::size_t size, std::string_view alphabet)
+    {
+        std::string text(size, ' ');
+        for (char& c : text)
+            c = alphabet[rnd() % alphabet.size()];
+        return text;
+    }
+
+    std::string log_lines(std::size_t count)
+    {
+        std::string log;
+        for (std::size_t i = 0; i < count; ++i)
+            log += "2024-06-18T12:00:" + std::to_string(i % 60) + ";INFO;worker-" + std::to_string(i % 16)
+                 + ";request processed in " + std::to_string(i % 1000) + "ms;status=200\n";
+        return log;
+    }
+} // namespace
+
+TEST_CASE("tokenize - the same tokens as views::split", "[ranges][tokenizer]")
+{
+    CHECK(simd_tokens("abc,def,ghi", ",") == std::vector{"abc"sv, "def"sv, "ghi"sv});
+    CHECK(simd_tokens(",a,,b,", ",") == std::vector{""sv, "a"sv, ""sv, "b"sv, ""sv});
+    CHECK(simd_tokens("key::value::", "::") == std::vector{"key"sv, "value"sv, ""sv});
+    CHECK(simd_tokens("", ",").empty());
+    CHECK(simd_tokens("abc", "") == std::vector{"a"sv, "b"sv, "c"sv});
+
+    std::string_view text = "one two  three";
+    std::vector<std::string_view> tokens;
+    for (std::string_view token : helpers::tokenize(text, ' ')) // lazy - no copies
+        tokens.push_back(token);
+    CHECK(tokens == std::vector{"one"sv, "two"sv, ""sv, "three"sv});
+}
+
+TEST_CASE("tokenize - fuzzed against views::split", "[ranges][tokenizer]")
+{
+    helpers::random::PCG rnd{665};
+
+    for (std::string_view separator : {","sv, "ab"sv, "::"sv, "aba"sv, "abcab"sv, "aaaa"sv})
+    {
+        for (int i = 0; i < 2'000; ++i)
+        {
+            const std::string text = random_text(rnd, rnd() % 200, "abc,:"); // crosses 16/32-byte blocks
+            INFO("separator: " << separator << " text: " << text);
+            REQUIRE(simd_tokens(text, separator) == split_tokens(text, separator));
+
+            const std::size_t pos = rnd() % (text.size() + 1);
+            REQUIRE(helpers::find_separator(text, separator, pos) == std::string_view{text}.find(separator, pos));
+        }
+    }
+}
+
+TEST_CASE("tokenize - log parsing", "[.][benchmark][tokenizer]")
+{
+    const std::string log = log_lines(100'000); // ~9MB
+
+    BENCHMARK("views::split - lines and fields")
+    {
+        std::size_t fields = 0;
+        for (auto line : log | std::views::split('\n'))
+            for ([[maybe_unused]] auto field : std::string_view{line.begin(), line.end()} | std::views::split(';'))
+                ++fields;
+        return fields;
+    };
+
+    BENCHMARK("helpers::tokenize - lines and fields")
+    {
+        std::size_t fields = 0;
+        for (std::string_view line : helpers::tokenize(log, '\n'))
+            for ([[maybe_unused]] std::string_view field : helpers::tokenize(line, ';'))
+                ++fields;
+        return fields;
+    };
+
+    BENCHMARK("views::split - multi-byte separator")
+    {
+        return std::ranges::distance(log | std::views::split("ms;"sv));
+    };
+
+    BENCHMARK("helpers::tokenize - multi-byte separator")
+    {
+        return std::ranges::distance(helpers::tokenize(log, "ms;"sv));
+    };
+}
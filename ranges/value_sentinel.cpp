@@ -0,0 +1,158 @@
+#include "value_sentinel.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Point
+    {
+        int x;
+        int y;
+
+        bool operator==(const Point&) const = default;
+    };
+} // namespace
+
+static_assert(sentinels::ValueSentinelFor<EndValue<'\0'>, const char*>);
+static_assert(sentinels::ValueSentinelFor<EndValue<42>, std::vector<int>::iterator>);
+static_assert(!sentinels::ValueSentinelFor<std::unreachable_sentinel_t, const char*>);
+
+TEST_CASE("sentinels::find_end", "[ranges][value_sentinel]")
+{
+    SECTION("C-string - strlen")
+    {
+        const char* txt = "acbgdef\0ajdhfg";
+        CHECK(sentinels::find_end(txt, EndValue<'\0'>{}) == txt + 7);
+        CHECK(sentinels::find_end(txt, EndValue<'g'>{}) == txt + 3);
+    }
+
+    SECTION("every start offset and length - the aligned scan must not miss or pass the end")
+    {
+        for (char c : {'\0', '#'})
+        {
+            alignas(64) char buffer[300];
+            for (std::size_t first = 0; first < 32; ++first)
+                for (std::size_t size = 0; first + size < 256; ++size)
+                {
+                    std::ranges::fill(buffer, 'x');
+                    buffer[first + size] = c;
+                    buffer[first + size + 8] = c; // later matches are ignored
+                    if (first > 0)
+                        buffer[first - 1] = c; // so are those before first
+
+                    const char* result = c == '\0' ? sentinels::find_end(buffer + first, EndValue<'\0'>{})
+                                                   : sentinels::find_end(buffer + first, EndValue<'#'>{});
+                    REQUIRE(result == buffer + first + size);
+                }
+        }
+    }
+
+    SECTION("wider elements")
+    {
+        std::vector<int> ints(100, 7);
+        ints[1] = 42; // before first
+        ints[67] = 42;
+        CHECK(sentinels::find_end(ints.begin() + 2, EndValue<42>{}) == ints.begin() + 67);
+
+        std::u16string u16(50, u'a');
+        u16[33] = u'z';
+        CHECK(sentinels::find_end(u16.data() + 5, EndValue<u'z'>{}) == u16.data() + 33);
+
+        std::vector<std::int64_t> longs = {1, 2, 3, -1, 4}; // no SIMD path - a plain loop
+        CHECK(sentinels::find_end(longs.begin(), EndValue<-1>{}) == longs.begin() + 3);
+    }
+
+    SECTION("class type value - a plain loop")
+    {
+        std::vector<Point> points = {{1, 2}, {3, 4}, {0, 0}, {5, 6}};
+        CHECK(sentinels::find_end(points.begin(), EndValue<Point{0, 0}>{}) == points.begin() + 2);
+        CHECK(sentinels::find_end(points.begin(), EndValue<Point{0, 0}>{}) == std::ranges::next(points.begin(), EndValue<Point{0, 0}>{}));
+    }
+
+    SECTION("other sentinels - like std::ranges::next")
+    {
+        std::vector<int> data = {1, 2, 3};
+        CHECK(sentinels::find_end(std::counted_iterator{data.begin(), 2}, std::default_sentinel).base() == data.begin() + 2);
+    }
+}
+
+TEST_CASE("sentinels - algorithms", "[ranges][value_sentinel]")
+{
+    std::vector data = {2, 3, 4, 1, 5, 42, 6, 7, 8, 9, 10};
+
+    CHECK(*sentinels::find(data.begin(), EndValue<42>{}, 1) == 1);
+    CHECK(sentinels::find(data.begin(), EndValue<42>{}, 7) == data.begin() + 5); // not found - the end of the range
+
+    auto last = sentinels::sort(data.begin(), EndValue<42>{}, std::greater{});
+    CHECK(last == data.begin() + 5);
+    CHECK(data == std::vector{5, 4, 3, 2, 1, 42, 6, 7, 8, 9, 10});
+
+    std::string str;
+    auto [in, out] = sentinels::copy("abc\0def", EndValue<'\0'>{}, std::back_inserter(str));
+    CHECK(str == "abc");
+    CHECK(*in == '\0');
+
+    auto range = sentinels::bounded(data.begin(), EndValue<8>{});
+    CHECK(std::ranges::size(range) == 8);
+}
+
+// the end of a 1M C-string: comparisons through the sentinel vs strlen/SIMD scan
+TEST_CASE("sentinels - EndValue vs strlen", "[.][benchmark][value_sentinel]")
+{
+    const std::string text(1'000'000, 'a');
+    std::string copy;
+
+    BENCHMARK("std::ranges::next - EndValue<'\\0'>")
+    {
+        return std::ranges::next(text.c_str(), EndValue<'\0'>{});
+    };
+
+    BENCHMARK("sentinels::find_end - EndValue<'\\0'>")
+    {
+        return sentinels::find_end(text.c_str(), EndValue<'\0'>{});
+    };
+
+    BENCHMARK("std::strlen")
+    {
+        return text.c_str() + std::strlen(text.c_str());
+    };
+
+    std::string with_hash = text;
+    with_hash.back() = '#';
+
+    BENCHMARK("std::ranges::next - EndValue<'#'>")
+    {
+        return std::ranges::next(with_hash.c_str(), EndValue<'#'>{});
+    };
+
+    BENCHMARK("sentinels::find_end - EndValue<'#'>")
+    {
+        return sentinels::find_end(with_hash.c_str(), EndValue<'#'>{});
+    };
+
+    BENCHMARK("std::memchr - '#'")
+    {
+        return std::memchr(with_hash.c_str(), '#', with_hash.size());
+    };
+
+    BENCHMARK("std::ranges::copy - EndValue<'\\0'>")
+    {
+        copy.resize(text.size());
+        return std::ranges::copy(text.c_str(), EndValue<'\0'>{}, copy.data()).out;
+    };
+
+    BENCHMARK("sentinels::copy - EndValue<'\\0'>")
+    {
+        copy.resize(text.size());
+        return sentinels::copy(text.c_str(), EndValue<'\0'>{}, copy.data()).out;
+    };
+}
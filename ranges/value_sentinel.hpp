@@ -0,0 +1,214 @@
+#ifndef VALUE_SENTINEL_HPP
+#define VALUE_SENTINEL_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VALUE_SENTINEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define VALUE_SENTINEL_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define VALUE_SENTINEL_NO_SANITIZE_ADDRESS
+#endif
+
+// sentinel - the range ends at the first element equal to Value (EndValue<'\0'> for C-strings)
+template <auto Value>
+struct EndValue
+{
+    bool operator==(auto it) const
+    {
+        return *it == Value;
+    }
+};
+
+namespace sentinels
+{
+    // sentinel trait - is_value_sentinel for sentinels comparing the element with a constant value;
+    // specialise it for other such sentinels to make them use the fast paths below
+    template <typename TSentinel>
+    struct value_sentinel_traits
+    {
+        static constexpr bool is_value_sentinel = false;
+    };
+
+    template <auto Value>
+    struct value_sentinel_traits<EndValue<Value>>
+    {
+        static constexpr bool is_value_sentinel = true;
+        static constexpr auto value = Value;
+    };
+
+    // a contiguous iterator with a value sentinel - its end can be found by scanning memory
+    template <typename TSentinel, typename TIterator>
+    concept ValueSentinelFor = std::sentinel_for<TSentinel, TIterator> && std::contiguous_iterator<TIterator>
+                            && value_sentinel_traits<TSentinel>::is_value_sentinel;
+
+    namespace details
+    {
+        template <typename T>
+        concept Char = std::same_as<T, char> || std::same_as<T, signed char> || std::same_as<T, unsigned char> || std::same_as<T, char8_t>;
+
+        // characters ended by '\0' - the comparison is checked only for character types (Value may be of a class type)
+        template <typename T, auto Value>
+        concept CString = Char<T> && requires { requires Value == 0; };
+
+        // elements compared as raw bytes: integers (and enums) of 1, 2 or 4 bytes equal to the value
+        template <typename T, auto Value>
+        concept SimdScannable = (std::integral<T> || std::is_enum_v<T>) && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)
+                             && requires { static_cast<T>(Value); } && static_cast<T>(Value) == Value;
+
+#if VALUE_SENTINEL_SSE2
+        template <typename T>
+        __m128i compare(__m128i data, __m128i needle) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm_cmpeq_epi8(data, needle);
+            else if constexpr (sizeof(T) == 2)
+                return _mm_cmpeq_epi16(data, needle);
+            else
+                return _mm_cmpeq_epi32(data, needle);
+        }
+
+        // a bit per byte of the elements of the aligned 16-byte block equal to the needle
+        template <typename T>
+        VALUE_SENTINEL_NO_SANITIZE_ADDRESS unsigned match_mask(const char* block, __m128i needle) noexcept
+        {
+            return static_cast<unsigned>(_mm_movemask_epi8(compare<T>(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), needle)));
+        }
+
+        // is there a match in the aligned 64-byte group of blocks
+        template <typename T>
+        VALUE_SENTINEL_NO_SANITIZE_ADDRESS bool any_match(const char* group, __m128i needle) noexcept
+        {
+            const auto* blocks = reinterpret_cast<const __m128i*>(group);
+            const __m128i matches = _mm_or_si128(_mm_or_si128(compare<T>(_mm_load_si128(blocks), needle), compare<T>(_mm_load_si128(blocks + 1), needle)),
+                _mm_or_si128(compare<T>(_mm_load_si128(blocks + 2), needle), compare<T>(_mm_load_si128(blocks + 3), needle)));
+            return _mm_movemask_epi8(matches) != 0;
+        }
+
+        // first element equal to value at or after first - there must be one;
+        // aligned loads never cross a page boundary, so reading past the end of the range is safe
+        // (though not for the address sanitizer - like in strlen implementations)
+        template <typename T>
+        const T* find_unbounded_sse2(const T* first, T value) noexcept
+        {
+            __m128i needle;
+            if constexpr (sizeof(T) == 1)
+                needle = _mm_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                needle = _mm_set1_epi16(static_cast<short>(value));
+            else
+                needle = _mm_set1_epi32(static_cast<int>(value));
+
+            const char* bytes = reinterpret_cast<const char*>(first);
+            const auto offset = static_cast<unsigned>(reinterpret_cast<std::uintptr_t>(bytes) % 16);
+            const char* block = bytes - offset;
+
+            // single blocks up to a 64-byte boundary, then 64 bytes per step
+            unsigned mask = match_mask<T>(block, needle) & (0xFFFFu << offset); // elements before first are ignored
+            while (mask == 0 && reinterpret_cast<std::uintptr_t>(block + 16) % 64 != 0)
+            {
+                block += 16;
+                mask = match_mask<T>(block, needle);
+            }
+            if (mask == 0)
+            {
+                block += 16;
+                while (!any_match<T>(block, needle))
+                    block += 64;
+                while ((mask = match_mask<T>(block, needle)) == 0)
+                    block += 16;
+            }
+            return reinterpret_cast<const T*>(block + std::countr_zero(mask));
+        }
+#endif
+
+        template <auto Value, typename T>
+        const T* find_end(const T* first) noexcept
+        {
+            if constexpr (CString<T, Value>)
+            {
+                return first + std::strlen(reinterpret_cast<const char*>(first)); // C-string - as fast as it gets
+            }
+#if VALUE_SENTINEL_SSE2
+            else if constexpr (SimdScannable<T, Value>)
+            {
+                return find_unbounded_sse2(first, static_cast<T>(Value));
+            }
+#endif
+            else
+            {
+                while (!(*first == Value))
+                    ++first;
+                return first;
+            }
+        }
+    } // namespace details
+
+    // end of [first, last) as an iterator - for a value sentinel found by strlen/SIMD scan
+    // instead of comparing the elements one by one through the sentinel
+    template <std::input_or_output_iterator TIterator, std::sentinel_for<TIterator> TSentinel>
+    TIterator find_end(TIterator first, TSentinel last)
+    {
+        if constexpr (ValueSentinelFor<TSentinel, TIterator>)
+        {
+            const auto* data = std::to_address(first);
+            const auto* end = details::find_end<value_sentinel_traits<TSentinel>::value>(data);
+            return first + (end - data);
+        }
+        else
+            return std::ranges::next(first, last);
+    }
+
+    // [first, last) as a sized common range - for the bulk (memmove, counted loop) paths of the algorithms
+    template <std::input_or_output_iterator TIterator, std::sentinel_for<TIterator> TSentinel>
+    std::ranges::subrange<TIterator> bounded(TIterator first, TSentinel last)
+    {
+        return {first, find_end(first, last)};
+    }
+
+    // algorithms - like std::ranges ones, with a value sentinel its end is found first
+    template <std::input_iterator TIterator, std::sentinel_for<TIterator> TSentinel, std::weakly_incrementable TOutput>
+        requires std::indirectly_copyable<TIterator, TOutput>
+    std::ranges::copy_result<TIterator, TOutput> copy(TIterator first, TSentinel last, TOutput out)
+    {
+        if constexpr (ValueSentinelFor<TSentinel, TIterator>)
+            return std::ranges::copy(first, find_end(first, last), std::move(out));
+        else
+            return std::ranges::copy(std::move(first), last, std::move(out));
+    }
+
+    template <std::input_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename T, typename TProjection = std::identity>
+        requires std::indirect_binary_predicate<std::ranges::equal_to, std::projected<TIterator, TProjection>, const T*>
+    TIterator find(TIterator first, TSentinel last, const T& value, TProjection proj = {})
+    {
+        if constexpr (ValueSentinelFor<TSentinel, TIterator>)
+            return std::ranges::find(first, find_end(first, last), value, std::move(proj));
+        else
+            return std::ranges::find(std::move(first), last, value, std::move(proj));
+    }
+
+    template <std::random_access_iterator TIterator, std::sentinel_for<TIterator> TSentinel, typename TCompare = std::ranges::less,
+        typename TProjection = std::identity>
+        requires std::sortable<TIterator, TCompare, TProjection>
+    TIterator sort(TIterator first, TSentinel last, TCompare comp = {}, TProjection proj = {})
+    {
+        return std::ranges::sort(first, find_end(first, last), std::move(comp), std::move(proj));
+    }
+} // namespace sentinels
+
+#endif